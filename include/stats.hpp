@@ -26,6 +26,8 @@
 
 namespace stats
 {
+    #include "stats_incl/engines/engines.hpp"
+
     #include "stats_incl/misc/misc.hpp"
 
     #include "stats_incl/dens/dens.hpp"
@@ -36,6 +38,10 @@ namespace stats
 
     #include "stats_incl/rand/rand.hpp"
 
+    #include "stats_incl/qmc/qmc.hpp"
+
+    #include "stats_incl/dists/dists.hpp"
+
     // #include "stats_incl/copula/"
 }
 
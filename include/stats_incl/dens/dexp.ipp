@@ -105,7 +105,31 @@ void
 dexp_vec(const eT* __stats_pointer_settings__ vals_in, const T1 rate_par, const bool log_form, 
                rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dexp,vals_in,vals_out,num_elem,rate_par,log_form);
+    const double rate_par_d = static_cast<double>(rate_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(exp_sanity_check(rate_par_d) && GCINT::is_finite(rate_par_d) && rate_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(dexp,vals_in,vals_out,num_elem,rate_par,log_form);
+        return;
+    }
+
+    const double log_rate_par = std::log(rate_par_d);
+
+    dens_batch_eval(vals_in,vals_out,num_elem,1.0,
+        [=](const double x) { return x >= 0.0 && GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = log_rate_par - rate_par_d*x_vals[j];
+            }
+
+            if (!log_form) {
+                batch_exp(vals,n_vals);
+            }
+        },
+        [=](const eT x) { return dexp(x,rate_par,log_form); });
 }
 #endif
 
@@ -126,7 +126,40 @@ void
 dgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool log_form, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dgamma,vals_in,vals_out,num_elem,shape_par,scale_par,log_form);
+    const double shape_par_d = static_cast<double>(shape_par);
+    const double scale_par_d = static_cast<double>(scale_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(gamma_sanity_check(shape_par_d,scale_par_d) && GCINT::all_finite(shape_par_d,scale_par_d) && shape_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(dgamma,vals_in,vals_out,num_elem,shape_par,scale_par,log_form);
+        return;
+    }
+
+    const double inv_scale_par = 1.0 / scale_par_d;
+    const double log_cons_term = - stmath::lgamma(shape_par_d) - shape_par_d*std::log(scale_par_d);
+
+    dens_batch_eval(vals_in,vals_out,num_elem,1.0,
+        [=](const double x) { return x >= STLIM<double>::min() && GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = x_vals[j];
+            }
+
+            batch_log(vals,n_vals);
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = log_cons_term + (shape_par_d - 1.0)*vals[j] - x_vals[j]*inv_scale_par;
+            }
+
+            if (!log_form) {
+                batch_exp(vals,n_vals);
+            }
+        },
+        [=](const eT x) { return dgamma(x,shape_par,scale_par,log_form); });
 }
 #endif
 
@@ -34,7 +34,8 @@ T
 dlogis_log_compute(const T z, const T sigma_par)
 noexcept
 {
-    return( - z - stmath::log(sigma_par) - T(2)*stmath::log(T(1) + stmath::exp(-z)) );
+    // the density is symmetric in z; using |z| keeps exp() from overflowing in the left tail
+    return( - stmath::abs(z) - stmath::log(sigma_par) - T(2)*stmath::log(T(1) + stmath::exp(-stmath::abs(z))) );
 }
 
 template<typename T>
@@ -119,7 +120,49 @@ void
 dlogis_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dlogis,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    const double mu_par_d = static_cast<double>(mu_par);
+    const double sigma_par_d = static_cast<double>(sigma_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(logis_sanity_check(mu_par_d,sigma_par_d) && GCINT::all_finite(mu_par_d,sigma_par_d) && sigma_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(dlogis,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+        return;
+    }
+
+    const double inv_sigma_par = 1.0 / sigma_par_d;
+    const double log_cons_term = - std::log(sigma_par_d);
+
+    dens_batch_eval(vals_in,vals_out,num_elem,mu_par_d,
+        [=](const double x) { return GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            // the density is symmetric in z: with -|z|, exp() cannot overflow
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = - std::abs(x_vals[j] - mu_par_d)*inv_sigma_par;
+            }
+
+            batch_exp(vals,n_vals);
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = 1.0 + vals[j];
+            }
+
+            batch_log(vals,n_vals);
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = log_cons_term - std::abs(x_vals[j] - mu_par_d)*inv_sigma_par - 2.0*vals[j];
+            }
+
+            if (!log_form) {
+                batch_exp(vals,n_vals);
+            }
+        },
+        [=](const eT x) { return dlogis(x,mu_par,sigma_par,log_form); });
 }
 #endif
 
@@ -124,7 +124,34 @@ void
 dnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    const double mu_par_d = static_cast<double>(mu_par);
+    const double sigma_par_d = static_cast<double>(sigma_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(norm_sanity_check(mu_par_d,sigma_par_d) && GCINT::all_finite(mu_par_d,sigma_par_d) && sigma_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(dnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+        return;
+    }
+
+    const double inv_sigma_par = 1.0 / sigma_par_d;
+    const double log_cons_term = - 0.5*GCEM_LOG_2PI - std::log(sigma_par_d);
+
+    dens_batch_eval(vals_in,vals_out,num_elem,mu_par_d,
+        [=](const double x) { return GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                const double z = (x_vals[j] - mu_par_d)*inv_sigma_par;
+                vals[j] = log_cons_term - 0.5*z*z;
+            }
+
+            if (!log_form) {
+                batch_exp(vals,n_vals);
+            }
+        },
+        [=](const eT x) { return dnorm(x,mu_par,sigma_par,log_form); });
 }
 #endif
 
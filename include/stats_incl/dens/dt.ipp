@@ -121,7 +121,41 @@ void
 dt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool log_form, 
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(dt,vals_in,vals_out,num_elem,dof_par,log_form);
+    const double dof_par_d = static_cast<double>(dof_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(t_sanity_check(dof_par_d) && GCINT::is_finite(dof_par_d) && dof_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(dt,vals_in,vals_out,num_elem,dof_par,log_form);
+        return;
+    }
+
+    const double log_mult_term = - (0.5*dof_par_d + 0.5);
+    const double log_cons_term = stmath::lgamma(0.5*dof_par_d + 0.5) - 0.5*(std::log(dof_par_d) + GCEM_LOG_PI) - stmath::lgamma(0.5*dof_par_d);
+
+    // the bound keeps the argument of batch_log finite
+
+    dens_batch_eval(vals_in,vals_out,num_elem,0.0,
+        [=](const double x) { return (x/dof_par_d)*x < 1e300; },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = 1.0 + (x_vals[j]/dof_par_d)*x_vals[j];
+            }
+
+            batch_log(vals,n_vals);
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = log_cons_term + log_mult_term*vals[j];
+            }
+
+            if (!log_form) {
+                batch_exp(vals,n_vals);
+            }
+        },
+        [=](const eT x) { return dt(x,dof_par,log_form); });
 }
 #endif
 
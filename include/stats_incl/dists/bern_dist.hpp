@@ -0,0 +1,82 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Bernoulli distribution object
+ */
+
+#ifndef _statslib_bern_dist_HPP
+#define _statslib_bern_dist_HPP
+
+/**
+ * @brief The Bernoulli distribution, with fixed parameters
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::bern_dist dist_obj(0.7);
+ * dist_obj(engine);
+ * dist_obj.logpdf(2);
+ * \endcode
+ */
+
+class bern_dist : public dist_base<bern_dist,llint_t>
+{
+    public:
+        using result_type = double;
+
+        bern_dist(const double prob_par);
+
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        result_type operator()(rngT& engine) const;
+
+        double pdf(const llint_t x) const;
+        double logpdf(const llint_t x) const;
+        double cdf(const llint_t x) const;
+        double quantile(const double p) const;
+
+        using dist_base<bern_dist,llint_t>::pdf;
+        using dist_base<bern_dist,llint_t>::logpdf;
+        using dist_base<bern_dist,llint_t>::cdf;
+        using dist_base<bern_dist,llint_t>::quantile;
+
+    private:
+        friend class dist_base<bern_dist,llint_t>;
+
+        template<typename rngT>
+        void fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals) const;
+
+        double prob_par_;
+
+        // parameter-only terms, computed once
+
+        bool regular_;
+        double log_prob_;
+        double log1m_prob_;
+
+        double logpdf_compute(const llint_t x) const;
+};
+
+//
+// include implementation files
+
+#include "bern_dist.ipp"
+
+#endif
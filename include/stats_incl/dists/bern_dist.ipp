@@ -0,0 +1,154 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Bernoulli distribution object
+ */
+
+/**
+ * @brief The Bernoulli distribution, with fixed parameters
+ *
+ * @param prob_par the probability parameter, a real-valued input.
+ */
+
+statslib_inline
+bern_dist::bern_dist(const double prob_par)
+: prob_par_(prob_par)
+{
+    regular_ = internal::bern_sanity_check(prob_par_) && prob_par_ > 0.0 && prob_par_ < 1.0;
+
+    log_prob_ = stmath::log(prob_par_);
+    log1m_prob_ = stmath::log(1.0 - prob_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rbern with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+bern_dist::result_type
+bern_dist::operator()(rngT& engine)
+const
+{
+    return rbern(prob_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+bern_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rbern_vec(prob_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+bern_dist::logpdf_compute(const llint_t x)
+const
+{
+    return( x == llint_t(1) ? log_prob_ : log1m_prob_ );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dbern(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+bern_dist::pdf(const llint_t x)
+const
+{
+    if (regular_ && (x == llint_t(0) || x == llint_t(1))) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dbern(x,prob_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dbern(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+bern_dist::logpdf(const llint_t x)
+const
+{
+    if (regular_ && (x == llint_t(0) || x == llint_t(1))) {
+        return logpdf_compute(x);
+    }
+
+    return dbern(x,prob_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pbern(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+bern_dist::cdf(const llint_t x)
+const
+{
+    return pbern(x,prob_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qbern(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+bern_dist::quantile(const double p)
+const
+{
+    return qbern(p,prob_par_);
+}
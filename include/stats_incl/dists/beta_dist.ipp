@@ -0,0 +1,154 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Beta distribution object
+ */
+
+/**
+ * @brief The Beta distribution, with fixed parameters
+ *
+ * @param a_par a real-valued shape parameter.
+ * @param b_par a real-valued shape parameter.
+ */
+
+statslib_inline
+beta_dist::beta_dist(const double a_par, const double b_par)
+: a_par_(a_par), b_par_(b_par)
+{
+    regular_ = internal::beta_sanity_check(a_par_,b_par_) && GCINT::all_finite(a_par_,b_par_) && a_par_ > 0.0 && b_par_ > 0.0;
+
+    log_norm_const_ = - (stmath::lgamma(a_par_) + stmath::lgamma(b_par_) - stmath::lgamma(a_par_ + b_par_));
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rbeta with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+beta_dist::result_type
+beta_dist::operator()(rngT& engine)
+const
+{
+    return rbeta(a_par_,b_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+beta_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rbeta_vec(a_par_,b_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+beta_dist::logpdf_compute(const double x)
+const
+{
+    return( log_norm_const_ + (a_par_ - 1.0)*std::log(x) + (b_par_ - 1.0)*std::log1p(-x) );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dbeta(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+beta_dist::pdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && x < 1.0) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dbeta(x,a_par_,b_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dbeta(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+beta_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && x < 1.0) {
+        return logpdf_compute(x);
+    }
+
+    return dbeta(x,a_par_,b_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pbeta(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+beta_dist::cdf(const double x)
+const
+{
+    return pbeta(x,a_par_,b_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qbeta(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+beta_dist::quantile(const double p)
+const
+{
+    return qbeta(p,a_par_,b_par_);
+}
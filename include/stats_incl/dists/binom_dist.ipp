@@ -0,0 +1,167 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Binomial distribution object
+ */
+
+/**
+ * @brief The Binomial distribution, with fixed parameters
+ *
+ * @param n_trials_par the number of trials, a non-negative integral-valued input.
+ * @param prob_par the probability parameter, a real-valued input.
+ */
+
+statslib_inline
+binom_dist::binom_dist(const llint_t n_trials_par, const double prob_par)
+: n_trials_par_(n_trials_par), prob_par_(prob_par)
+{
+    regular_ = internal::binom_sanity_check(n_trials_par_,prob_par_) && n_trials_par_ > llint_t(1) && prob_par_ > 0.0 && prob_par_ < 1.0;
+
+    log_prob_ = stmath::log(prob_par_);
+    log1m_prob_ = stmath::log(1.0 - prob_par_);
+    lgamma_n_p1_ = internal::rpois_log_gamma(static_cast<double>(n_trials_par_) + 1.0);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rbinom with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+binom_dist::result_type
+binom_dist::operator()(rngT& engine)
+const
+{
+    return rbinom(n_trials_par_,prob_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+binom_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rbinom_vec(n_trials_par_,prob_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+binom_dist::logpdf_compute(const llint_t x)
+const
+{
+    // log-gamma terms via the Stirling series of rpois, which avoids the global state of std::lgamma
+
+    const double x_d = static_cast<double>(x);
+    const double n_d = static_cast<double>(n_trials_par_);
+
+    return( x == llint_t(0) ? \
+                n_d*log1m_prob_ :
+            x == n_trials_par_ ? \
+                x_d*log_prob_ :
+            //
+            lgamma_n_p1_ - internal::rpois_log_gamma(x_d + 1.0) - internal::rpois_log_gamma(n_d - x_d + 1.0) \
+                + x_d*log_prob_ + (n_d - x_d)*log1m_prob_ );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dbinom(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+binom_dist::pdf(const llint_t x)
+const
+{
+    if (regular_ && x >= llint_t(0) && x <= n_trials_par_) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dbinom(x,n_trials_par_,prob_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dbinom(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+binom_dist::logpdf(const llint_t x)
+const
+{
+    if (regular_ && x >= llint_t(0) && x <= n_trials_par_) {
+        return logpdf_compute(x);
+    }
+
+    return dbinom(x,n_trials_par_,prob_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pbinom(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+binom_dist::cdf(const llint_t x)
+const
+{
+    return pbinom(x,n_trials_par_,prob_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qbinom(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+binom_dist::quantile(const double p)
+const
+{
+    return qbinom(p,n_trials_par_,prob_par_);
+}
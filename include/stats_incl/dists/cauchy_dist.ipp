@@ -0,0 +1,165 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Cauchy distribution object
+ */
+
+/**
+ * @brief The Cauchy distribution, with fixed parameters
+ *
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ */
+
+statslib_inline
+cauchy_dist::cauchy_dist(const double mu_par, const double sigma_par)
+: mu_par_(mu_par), sigma_par_(sigma_par)
+{
+    regular_ = internal::cauchy_sanity_check(mu_par_,sigma_par_) && GCINT::all_finite(mu_par_,sigma_par_) && sigma_par_ > 0.0;
+
+    inv_sigma_par_ = 1.0 / sigma_par_;
+    log_norm_const_ = - stmath::log(sigma_par_*GCEM_PI);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rcauchy with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+cauchy_dist::result_type
+cauchy_dist::operator()(rngT& engine)
+const
+{
+    return rcauchy(mu_par_,sigma_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+cauchy_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rcauchy_vec(mu_par_,sigma_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+cauchy_dist::logpdf_compute(const double x)
+const
+{
+    const double z = (x - mu_par_)*inv_sigma_par_;
+
+    return( log_norm_const_ - std::log1p(z*z) );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dcauchy(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+cauchy_dist::pdf(const double x)
+const
+{
+    if (regular_ && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dcauchy(x,mu_par_,sigma_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dcauchy(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+cauchy_dist::logpdf(const double x)
+const
+{
+    if (regular_ && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dcauchy(x,mu_par_,sigma_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pcauchy(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+cauchy_dist::cdf(const double x)
+const
+{
+    if (regular_ && GCINT::is_finite(x)) {
+        return internal::pcauchy_compute((x - mu_par_)*inv_sigma_par_);
+    }
+
+    return pcauchy(x,mu_par_,sigma_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qcauchy(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+cauchy_dist::quantile(const double p)
+const
+{
+    if (regular_ && p > 0.0 && p < 1.0) {
+        return( mu_par_ + sigma_par_*std::tan(GCEM_PI*(p - 0.5)) );
+    }
+
+    return qcauchy(p,mu_par_,sigma_par_);
+}
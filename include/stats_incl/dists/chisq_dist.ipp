@@ -0,0 +1,153 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Chi-squared distribution object
+ */
+
+/**
+ * @brief The Chi-squared distribution, with fixed parameters
+ *
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ */
+
+statslib_inline
+chisq_dist::chisq_dist(const double dof_par)
+: dof_par_(dof_par)
+{
+    regular_ = internal::chisq_sanity_check(dof_par_) && GCINT::is_finite(dof_par_) && dof_par_ > 0.0;
+
+    log_norm_const_ = - stmath::lgamma(0.5*dof_par_) - 0.5*dof_par_*GCEM_LOG_2;
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rchisq with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+chisq_dist::result_type
+chisq_dist::operator()(rngT& engine)
+const
+{
+    return rchisq(dof_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+chisq_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rchisq_vec(dof_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+chisq_dist::logpdf_compute(const double x)
+const
+{
+    return( log_norm_const_ + (0.5*dof_par_ - 1.0)*std::log(x) - 0.5*x );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dchisq(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+chisq_dist::pdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dchisq(x,dof_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dchisq(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+chisq_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dchisq(x,dof_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pchisq(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+chisq_dist::cdf(const double x)
+const
+{
+    return pchisq(x,dof_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qchisq(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+chisq_dist::quantile(const double p)
+const
+{
+    return qchisq(p,dof_par_);
+}
@@ -0,0 +1,57 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Common base of the distribution objects
+ */
+
+#ifndef _statslib_dist_base_HPP
+#define _statslib_dist_base_HPP
+
+/**
+ * @brief Members shared by the distribution objects (CRTP base)
+ *
+ * \c distT supplies \c operator() and, with the vector/matrix features, \c fill_vec (the bulk sampler);
+ * objects with a density also supply the scalar \c pdf, \c logpdf, \c cdf and \c quantile, with the first
+ * three taking an \c inpT.
+ */
+
+template<typename distT, typename inpT = double>
+class dist_base
+{
+    public:
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        void fill(rngT& engine, double* vals_out, const ullint_t n_vals) const;
+
+        void pdf(const inpT* vals_in, double* vals_out, const ullint_t n_vals) const;
+        void logpdf(const inpT* vals_in, double* vals_out, const ullint_t n_vals) const;
+        void cdf(const inpT* vals_in, double* vals_out, const ullint_t n_vals) const;
+        void quantile(const double* vals_in, double* vals_out, const ullint_t n_vals) const;
+
+    protected:
+        const distT& derived() const;
+};
+
+//
+// include implementation files
+
+#include "dist_base.ipp"
+
+#endif
@@ -0,0 +1,132 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Common base of the distribution objects
+ */
+
+template<typename distT, typename inpT>
+statslib_inline
+const distT&
+dist_base<distT,inpT>::derived()
+const
+{
+    return static_cast<const distT&>(*this);
+}
+
+/**
+ * @brief Fill an array with draws from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ * @param vals_out a pointer to \c n_vals values, which are overwritten.
+ * @param n_vals the number of draws.
+ */
+
+template<typename distT, typename inpT>
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+void
+dist_base<distT,inpT>::fill(rngT& engine, double* vals_out, const ullint_t n_vals)
+const
+{
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+    derived().fill_vec(engine,vals_out,n_vals);
+#else
+    for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+        vals_out[j] = derived()(engine);
+    }
+#endif
+}
+
+/**
+ * @brief Evaluate the density function over an array
+ *
+ * @param vals_in a pointer to \c n_vals input values.
+ * @param vals_out a pointer to \c n_vals values, which are overwritten.
+ * @param n_vals the number of values.
+ */
+
+template<typename distT, typename inpT>
+statslib_inline
+void
+dist_base<distT,inpT>::pdf(const inpT* vals_in, double* vals_out, const ullint_t n_vals)
+const
+{
+    for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+        vals_out[j] = derived().pdf(vals_in[j]);
+    }
+}
+
+/**
+ * @brief Evaluate the log-density function over an array
+ *
+ * @param vals_in a pointer to \c n_vals input values.
+ * @param vals_out a pointer to \c n_vals values, which are overwritten.
+ * @param n_vals the number of values.
+ */
+
+template<typename distT, typename inpT>
+statslib_inline
+void
+dist_base<distT,inpT>::logpdf(const inpT* vals_in, double* vals_out, const ullint_t n_vals)
+const
+{
+    for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+        vals_out[j] = derived().logpdf(vals_in[j]);
+    }
+}
+
+/**
+ * @brief Evaluate the distribution function over an array
+ *
+ * @param vals_in a pointer to \c n_vals input values.
+ * @param vals_out a pointer to \c n_vals values, which are overwritten.
+ * @param n_vals the number of values.
+ */
+
+template<typename distT, typename inpT>
+statslib_inline
+void
+dist_base<distT,inpT>::cdf(const inpT* vals_in, double* vals_out, const ullint_t n_vals)
+const
+{
+    for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+        vals_out[j] = derived().cdf(vals_in[j]);
+    }
+}
+
+/**
+ * @brief Evaluate the quantile function over an array
+ *
+ * @param vals_in a pointer to \c n_vals input values.
+ * @param vals_out a pointer to \c n_vals values, which are overwritten.
+ * @param n_vals the number of values.
+ */
+
+template<typename distT, typename inpT>
+statslib_inline
+void
+dist_base<distT,inpT>::quantile(const double* vals_in, double* vals_out, const ullint_t n_vals)
+const
+{
+    for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+        vals_out[j] = derived().quantile(vals_in[j]);
+    }
+}
@@ -0,0 +1,61 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Distribution objects
+ *
+ * Each object holds a fixed set of parameters. The parameters are checked, and the parameter-only
+ * terms of the density (normalizing constants, logs of parameters, and so on) computed, once at
+ * construction; pdf, logpdf, cdf and quantile then do only the per-value work. The results match the
+ * corresponding free functions (dnorm, pnorm, qnorm, ...) up to rounding, not bit for bit, as the
+ * precomputed terms are combined in a different order. Non-finite inputs and degenerate parameters are
+ * passed to the free functions.
+ *
+ * A single draw matches the rnorm-style function with the same engine, and fill uses the bulk sampler
+ * behind rnorm<mT>. fill and the array overloads of pdf, logpdf, cdf and quantile come from dist_base.
+ */
+
+#ifndef _statslib_dists_HPP
+#define _statslib_dists_HPP
+
+#include "dist_base.hpp"
+
+#include "bern_dist.hpp"
+#include "beta_dist.hpp"
+#include "binom_dist.hpp"
+#include "cauchy_dist.hpp"
+#include "chisq_dist.hpp"
+#include "exp_dist.hpp"
+#include "f_dist.hpp"
+#include "gamma_dist.hpp"
+#include "invgamma_dist.hpp"
+#include "laplace_dist.hpp"
+#include "lnorm_dist.hpp"
+#include "logis_dist.hpp"
+#include "norm_dist.hpp"
+#include "pois_dist.hpp"
+#include "t_dist.hpp"
+#include "tnorm_dist.hpp"
+#include "unif_dist.hpp"
+#include "weibull_dist.hpp"
+
+#include "sampler.hpp"
+
+#endif
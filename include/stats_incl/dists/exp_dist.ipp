@@ -0,0 +1,161 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Exponential distribution object
+ */
+
+/**
+ * @brief The Exponential distribution, with fixed parameters
+ *
+ * @param rate_par the rate parameter, a real-valued input.
+ */
+
+statslib_inline
+exp_dist::exp_dist(const double rate_par)
+: rate_par_(rate_par)
+{
+    regular_ = internal::exp_sanity_check(rate_par_) && GCINT::is_finite(rate_par_) && rate_par_ > 0.0;
+
+    log_rate_ = stmath::log(rate_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rexp with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+exp_dist::result_type
+exp_dist::operator()(rngT& engine)
+const
+{
+    return rexp(rate_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+exp_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rexp_vec(rate_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+exp_dist::logpdf_compute(const double x)
+const
+{
+    return( log_rate_ - rate_par_*x );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dexp(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+exp_dist::pdf(const double x)
+const
+{
+    if (regular_ && x >= 0.0 && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dexp(x,rate_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dexp(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+exp_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x >= 0.0 && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dexp(x,rate_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pexp(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+exp_dist::cdf(const double x)
+const
+{
+    if (regular_ && x >= 0.0 && GCINT::is_finite(x)) {
+        return( - std::expm1(-rate_par_*x) );
+    }
+
+    return pexp(x,rate_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qexp(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+exp_dist::quantile(const double p)
+const
+{
+    if (regular_ && p >= 0.0 && p < 1.0) {
+        return( - std::log1p(-p) / rate_par_ );
+    }
+
+    return qexp(p,rate_par_);
+}
@@ -0,0 +1,158 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * F distribution object
+ */
+
+/**
+ * @brief The F distribution, with fixed parameters
+ *
+ * @param df1_par a degrees of freedom parameter, a real-valued input.
+ * @param df2_par a degrees of freedom parameter, a real-valued input.
+ */
+
+statslib_inline
+f_dist::f_dist(const double df1_par, const double df2_par)
+: df1_par_(df1_par), df2_par_(df2_par)
+{
+    regular_ = internal::f_sanity_check(df1_par_,df2_par_) && GCINT::all_finite(df1_par_,df2_par_) && df1_par_ > 0.0 && df2_par_ > 0.0;
+
+    df_ratio_ = df1_par_ / df2_par_;
+    log_x_coef_ = 0.5*df1_par_ - 1.0;
+    log_mult_coef_ = - 0.5*(df1_par_ + df2_par_);
+    log_norm_const_ = - (stmath::lgamma(0.5*df1_par_) + stmath::lgamma(0.5*df2_par_) - stmath::lgamma(0.5*(df1_par_ + df2_par_))) \
+                      + 0.5*df1_par_*stmath::log(df_ratio_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rf with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+f_dist::result_type
+f_dist::operator()(rngT& engine)
+const
+{
+    return rf(df1_par_,df2_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+f_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rf_vec(df1_par_,df2_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+f_dist::logpdf_compute(const double x)
+const
+{
+    return( log_norm_const_ + log_x_coef_*std::log(x) + log_mult_coef_*std::log1p(df_ratio_*x) );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>df(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+f_dist::pdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return df(x,df1_par_,df2_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>df(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+f_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return df(x,df1_par_,df2_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pf(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+f_dist::cdf(const double x)
+const
+{
+    return pf(x,df1_par_,df2_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qf(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+f_dist::quantile(const double p)
+const
+{
+    return qf(p,df1_par_,df2_par_);
+}
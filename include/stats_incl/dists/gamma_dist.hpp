@@ -0,0 +1,83 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Gamma distribution object
+ */
+
+#ifndef _statslib_gamma_dist_HPP
+#define _statslib_gamma_dist_HPP
+
+/**
+ * @brief The Gamma distribution, with fixed parameters
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::gamma_dist dist_obj(2.0,3.0);
+ * dist_obj(engine);
+ * dist_obj.logpdf(1.5);
+ * \endcode
+ */
+
+class gamma_dist : public dist_base<gamma_dist>
+{
+    public:
+        using result_type = double;
+
+        gamma_dist(const double shape_par, const double scale_par);
+
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        result_type operator()(rngT& engine) const;
+
+        double pdf(const double x) const;
+        double logpdf(const double x) const;
+        double cdf(const double x) const;
+        double quantile(const double p) const;
+
+        using dist_base<gamma_dist>::pdf;
+        using dist_base<gamma_dist>::logpdf;
+        using dist_base<gamma_dist>::cdf;
+        using dist_base<gamma_dist>::quantile;
+
+    private:
+        friend class dist_base<gamma_dist>;
+
+        template<typename rngT>
+        void fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals) const;
+
+        double shape_par_;
+        double scale_par_;
+
+        // parameter-only terms, computed once
+
+        bool regular_;
+        double inv_scale_par_;
+        double log_norm_const_;
+
+        double logpdf_compute(const double x) const;
+};
+
+//
+// include implementation files
+
+#include "gamma_dist.ipp"
+
+#endif
@@ -0,0 +1,155 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Gamma distribution object
+ */
+
+/**
+ * @brief The Gamma distribution, with fixed parameters
+ *
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ */
+
+statslib_inline
+gamma_dist::gamma_dist(const double shape_par, const double scale_par)
+: shape_par_(shape_par), scale_par_(scale_par)
+{
+    regular_ = internal::gamma_sanity_check(shape_par_,scale_par_) && GCINT::all_finite(shape_par_,scale_par_) && shape_par_ > 0.0;
+
+    inv_scale_par_ = 1.0 / scale_par_;
+    log_norm_const_ = - stmath::lgamma(shape_par_) - shape_par_*stmath::log(scale_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rgamma with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+gamma_dist::result_type
+gamma_dist::operator()(rngT& engine)
+const
+{
+    return rgamma(shape_par_,scale_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+gamma_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rgamma_vec(shape_par_,scale_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+gamma_dist::logpdf_compute(const double x)
+const
+{
+    return( log_norm_const_ + (shape_par_ - 1.0)*std::log(x) - x*inv_scale_par_ );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dgamma(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+gamma_dist::pdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dgamma(x,shape_par_,scale_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dgamma(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+gamma_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dgamma(x,shape_par_,scale_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pgamma(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+gamma_dist::cdf(const double x)
+const
+{
+    return pgamma(x,shape_par_,scale_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qgamma(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+gamma_dist::quantile(const double p)
+const
+{
+    return qgamma(p,shape_par_,scale_par_);
+}
@@ -0,0 +1,154 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * inverse Gamma distribution object
+ */
+
+/**
+ * @brief The inverse Gamma distribution, with fixed parameters
+ *
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param rate_par the rate parameter, a real-valued input.
+ */
+
+statslib_inline
+invgamma_dist::invgamma_dist(const double shape_par, const double rate_par)
+: shape_par_(shape_par), rate_par_(rate_par)
+{
+    regular_ = internal::invgamma_sanity_check(shape_par_,rate_par_) && GCINT::all_finite(shape_par_,rate_par_) && shape_par_ > 0.0 && rate_par_ > 0.0;
+
+    log_norm_const_ = - stmath::lgamma(shape_par_) + shape_par_*stmath::log(rate_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rinvgamma with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+invgamma_dist::result_type
+invgamma_dist::operator()(rngT& engine)
+const
+{
+    return rinvgamma(shape_par_,rate_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+invgamma_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rinvgamma_vec(shape_par_,rate_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+invgamma_dist::logpdf_compute(const double x)
+const
+{
+    return( log_norm_const_ - (shape_par_ + 1.0)*std::log(x) - rate_par_/x );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dinvgamma(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+invgamma_dist::pdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dinvgamma(x,shape_par_,rate_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dinvgamma(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+invgamma_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dinvgamma(x,shape_par_,rate_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pinvgamma(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+invgamma_dist::cdf(const double x)
+const
+{
+    return pinvgamma(x,shape_par_,rate_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qinvgamma(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+invgamma_dist::quantile(const double p)
+const
+{
+    return qinvgamma(p,shape_par_,rate_par_);
+}
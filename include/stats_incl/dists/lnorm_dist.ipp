@@ -0,0 +1,162 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * log-Normal distribution object
+ */
+
+/**
+ * @brief The log-Normal distribution, with fixed parameters
+ *
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ */
+
+statslib_inline
+lnorm_dist::lnorm_dist(const double mu_par, const double sigma_par)
+: mu_par_(mu_par), sigma_par_(sigma_par)
+{
+    regular_ = internal::lnorm_sanity_check(mu_par_,sigma_par_) && GCINT::all_finite(mu_par_,sigma_par_) && sigma_par_ > 0.0;
+
+    inv_sigma_par_ = 1.0 / sigma_par_;
+    log_norm_const_ = - 0.5*GCEM_LOG_2PI - stmath::log(sigma_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rlnorm with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+lnorm_dist::result_type
+lnorm_dist::operator()(rngT& engine)
+const
+{
+    return rlnorm(mu_par_,sigma_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+lnorm_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rlnorm_vec(mu_par_,sigma_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+lnorm_dist::logpdf_compute(const double x)
+const
+{
+    const double log_x = std::log(x);
+    const double z = (log_x - mu_par_)*inv_sigma_par_;
+
+    return( log_norm_const_ - 0.5*z*z - log_x );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dlnorm(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+lnorm_dist::pdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dlnorm(x,mu_par_,sigma_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dlnorm(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+lnorm_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dlnorm(x,mu_par_,sigma_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>plnorm(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+lnorm_dist::cdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return internal::pnorm_cody((std::log(x) - mu_par_)*inv_sigma_par_,false);
+    }
+
+    return plnorm(x,mu_par_,sigma_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qlnorm(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+lnorm_dist::quantile(const double p)
+const
+{
+    return qlnorm(p,mu_par_,sigma_par_);
+}
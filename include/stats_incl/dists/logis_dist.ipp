@@ -0,0 +1,167 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Logistic distribution object
+ */
+
+/**
+ * @brief The Logistic distribution, with fixed parameters
+ *
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ */
+
+statslib_inline
+logis_dist::logis_dist(const double mu_par, const double sigma_par)
+: mu_par_(mu_par), sigma_par_(sigma_par)
+{
+    regular_ = internal::logis_sanity_check(mu_par_,sigma_par_) && GCINT::all_finite(mu_par_,sigma_par_) && sigma_par_ > 0.0;
+
+    inv_sigma_par_ = 1.0 / sigma_par_;
+    log_norm_const_ = - stmath::log(sigma_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rlogis with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+logis_dist::result_type
+logis_dist::operator()(rngT& engine)
+const
+{
+    return rlogis(mu_par_,sigma_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+logis_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rlogis_vec(mu_par_,sigma_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+logis_dist::logpdf_compute(const double x)
+const
+{
+    // the density is symmetric in z; using -|z| keeps exp() from overflowing
+
+    const double z_abs = std::abs(x - mu_par_)*inv_sigma_par_;
+
+    return( log_norm_const_ - z_abs - 2.0*std::log1p(std::exp(-z_abs)) );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dlogis(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+logis_dist::pdf(const double x)
+const
+{
+    if (regular_ && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dlogis(x,mu_par_,sigma_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dlogis(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+logis_dist::logpdf(const double x)
+const
+{
+    if (regular_ && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dlogis(x,mu_par_,sigma_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>plogis(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+logis_dist::cdf(const double x)
+const
+{
+    if (regular_ && GCINT::is_finite(x)) {
+        return( 0.5*(1.0 + std::tanh(0.5*(x - mu_par_)*inv_sigma_par_)) );
+    }
+
+    return plogis(x,mu_par_,sigma_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qlogis(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+logis_dist::quantile(const double p)
+const
+{
+    if (regular_ && p > 0.0 && p < 1.0) {
+        return( mu_par_ + sigma_par_*std::log(p / (1.0 - p)) );
+    }
+
+    return qlogis(p,mu_par_,sigma_par_);
+}
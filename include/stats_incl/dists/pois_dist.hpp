@@ -0,0 +1,81 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Poisson distribution object
+ */
+
+#ifndef _statslib_pois_dist_HPP
+#define _statslib_pois_dist_HPP
+
+/**
+ * @brief The Poisson distribution, with fixed parameters
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::pois_dist dist_obj(8.0);
+ * dist_obj(engine);
+ * dist_obj.logpdf(2);
+ * \endcode
+ */
+
+class pois_dist : public dist_base<pois_dist,llint_t>
+{
+    public:
+        using result_type = double;
+
+        pois_dist(const double rate_par);
+
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        result_type operator()(rngT& engine) const;
+
+        double pdf(const llint_t x) const;
+        double logpdf(const llint_t x) const;
+        double cdf(const llint_t x) const;
+        double quantile(const double p) const;
+
+        using dist_base<pois_dist,llint_t>::pdf;
+        using dist_base<pois_dist,llint_t>::logpdf;
+        using dist_base<pois_dist,llint_t>::cdf;
+        using dist_base<pois_dist,llint_t>::quantile;
+
+    private:
+        friend class dist_base<pois_dist,llint_t>;
+
+        template<typename rngT>
+        void fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals) const;
+
+        double rate_par_;
+
+        // parameter-only terms, computed once
+
+        bool regular_;
+        double log_rate_;
+
+        double logpdf_compute(const llint_t x) const;
+};
+
+//
+// include implementation files
+
+#include "pois_dist.ipp"
+
+#endif
@@ -0,0 +1,157 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Poisson distribution object
+ */
+
+/**
+ * @brief The Poisson distribution, with fixed parameters
+ *
+ * @param rate_par the rate parameter, a real-valued input.
+ */
+
+statslib_inline
+pois_dist::pois_dist(const double rate_par)
+: rate_par_(rate_par)
+{
+    regular_ = internal::pois_sanity_check(rate_par_) && GCINT::is_finite(rate_par_) && rate_par_ > 0.0;
+
+    log_rate_ = stmath::log(rate_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rpois with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+pois_dist::result_type
+pois_dist::operator()(rngT& engine)
+const
+{
+    return rpois(rate_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+pois_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rpois_vec(rate_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+pois_dist::logpdf_compute(const llint_t x)
+const
+{
+    // log-gamma terms via the Stirling series of rpois, which avoids the global state of std::lgamma
+
+    const double x_d = static_cast<double>(x);
+
+    return( x_d*log_rate_ - rate_par_ - internal::rpois_log_gamma(x_d + 1.0) );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dpois(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+pois_dist::pdf(const llint_t x)
+const
+{
+    if (regular_ && x >= llint_t(0)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dpois(x,rate_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dpois(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+pois_dist::logpdf(const llint_t x)
+const
+{
+    if (regular_ && x >= llint_t(0)) {
+        return logpdf_compute(x);
+    }
+
+    return dpois(x,rate_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x an integral-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>ppois(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+pois_dist::cdf(const llint_t x)
+const
+{
+    return ppois(x,rate_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qpois(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+pois_dist::quantile(const double p)
+const
+{
+    return qpois(p,rate_par_);
+}
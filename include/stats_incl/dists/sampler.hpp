@@ -0,0 +1,125 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Buffered stream of draws from a distribution object
+ */
+
+#ifndef _statslib_sampler_HPP
+#define _statslib_sampler_HPP
+
+/**
+ * @brief A stream of draws from a distribution object
+ *
+ * Draws are generated in blocks of \c STATS_SAMPLER_BLOCK_SIZE with the bulk sampler of the distribution,
+ * and handed out one at a time by \c next, in chunks by \c fill, or through an (unbounded) input iterator.
+ * Only one block is held in memory, so arbitrarily long streams can be consumed through a fixed-size buffer.
+ * The sequence of draws does not depend on how it is consumed: any mix of \c next and \c fill calls
+ * returns the same values.
+ *
+ * The sampler holds its own random engine, seeded from the engine (or seed value) passed to the constructor.
+ * Without the vector/matrix features, blocks are filled by repeated single draws, so the stream differs from
+ * that of a build with them enabled.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sampler<stats::norm_dist> norm_draws(stats::norm_dist(1.0,2.0),engine);
+ *
+ * double x = norm_draws.next();
+ *
+ * std::vector<double> buffer(4096);
+ * norm_draws.fill(buffer.data(),buffer.size());
+ *
+ * std::copy_n(norm_draws.begin(),100,buffer.begin());
+ * \endcode
+ */
+
+template<typename distT>
+class sampler
+{
+    public:
+        using result_type = typename distT::result_type;
+
+        class iterator
+        {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = result_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const result_type*;
+                using reference = const result_type&;
+
+                iterator() = default;
+                explicit iterator(sampler* sampler_ptr);
+
+                reference operator*() const;
+                pointer operator->() const;
+
+                iterator& operator++();
+                iterator operator++(int);
+
+                bool operator==(const iterator& rhs) const;
+                bool operator!=(const iterator& rhs) const;
+
+            private:
+                sampler* sampler_ptr_ = nullptr;
+                result_type val_ = result_type(0);
+        };
+
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        sampler(const distT& dist_obj, rngT& engine);
+
+        sampler(const distT& dist_obj, const ullint_t seed_val);
+
+        explicit sampler(const distT& dist_obj);
+
+        const distT& dist() const;
+        ullint_t index() const;
+
+        result_type next();
+        result_type operator()();
+
+        void fill(result_type* vals_out, const ullint_t n_vals);
+
+        iterator begin();
+        iterator end();
+
+        void reset();
+
+    private:
+        distT dist_obj_;
+
+        ullint_t seed_val_ = 0;
+        xoshiro256pp engine_;
+
+        std::vector<result_type> block_vals_;
+        ullint_t block_pos_ = 0;
+        ullint_t n_draws_ = 0;
+
+        void refill();
+};
+
+//
+// include implementation files
+
+#include "sampler.ipp"
+
+#endif
@@ -0,0 +1,280 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Buffered stream of draws from a distribution object
+ */
+
+/**
+ * @brief A stream of draws from a distribution object
+ *
+ * @param dist_obj a distribution object, such as \c stats::norm_dist.
+ * @param engine a random engine, passed by reference, used to seed the sampler.
+ */
+
+template<typename distT>
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+sampler<distT>::sampler(const distT& dist_obj, rngT& engine)
+: dist_obj_(dist_obj), seed_val_(internal::rand_bits64(engine))
+{
+    reset();
+}
+
+/**
+ * @brief A stream of draws from a distribution object
+ *
+ * @param dist_obj a distribution object, such as \c stats::norm_dist.
+ * @param seed_val a non-negative integral-valued seed.
+ */
+
+template<typename distT>
+statslib_inline
+sampler<distT>::sampler(const distT& dist_obj, const ullint_t seed_val)
+: dist_obj_(dist_obj), seed_val_(seed_val)
+{
+    reset();
+}
+
+/**
+ * @brief A stream of draws from a distribution object, seeded from the default engine of the calling thread
+ *
+ * @param dist_obj a distribution object, such as \c stats::norm_dist.
+ */
+
+template<typename distT>
+statslib_inline
+sampler<distT>::sampler(const distT& dist_obj)
+: dist_obj_(dist_obj), seed_val_(internal::rand_bits64(internal::default_engine()))
+{
+    reset();
+}
+
+/**
+ * @brief The distribution object
+ */
+
+template<typename distT>
+statslib_inline
+const distT&
+sampler<distT>::dist()
+const
+{
+    return dist_obj_;
+}
+
+/**
+ * @brief The number of draws handed out since construction or the last call to \c reset
+ */
+
+template<typename distT>
+statslib_inline
+ullint_t
+sampler<distT>::index()
+const
+{
+    return n_draws_;
+}
+
+/**
+ * @brief The next draw of the stream
+ */
+
+template<typename distT>
+statslib_inline
+typename sampler<distT>::result_type
+sampler<distT>::next()
+{
+    if (block_pos_ == block_vals_.size()) {
+        refill();
+    }
+
+    ++n_draws_;
+
+    return block_vals_[block_pos_++];
+}
+
+template<typename distT>
+statslib_inline
+typename sampler<distT>::result_type
+sampler<distT>::operator()()
+{
+    return next();
+}
+
+/**
+ * @brief Copy the next draws of the stream to an array
+ *
+ * @param vals_out a pointer to \c n_vals values, which are overwritten.
+ * @param n_vals the number of draws.
+ *
+ * Whole blocks are generated directly in \c vals_out, without passing through the buffer.
+ */
+
+template<typename distT>
+statslib_inline
+void
+sampler<distT>::fill(result_type* vals_out, const ullint_t n_vals)
+{
+    const ullint_t block_size = block_vals_.size();
+
+    ullint_t n_done = 0;
+
+    // the rest of the current block
+
+    while (n_done < n_vals && block_pos_ < block_size) {
+        vals_out[n_done++] = block_vals_[block_pos_++];
+    }
+
+    // whole blocks
+
+    while (n_vals - n_done >= block_size)
+    {
+        dist_obj_.fill(engine_,vals_out + n_done,block_size);
+        n_done += block_size;
+    }
+
+    // the start of a new block
+
+    if (n_done < n_vals)
+    {
+        refill();
+
+        while (n_done < n_vals) {
+            vals_out[n_done++] = block_vals_[block_pos_++];
+        }
+    }
+
+    n_draws_ += n_vals;
+}
+
+/**
+ * @brief An input iterator over the stream; every increment takes the next draw
+ */
+
+template<typename distT>
+statslib_inline
+typename sampler<distT>::iterator
+sampler<distT>::begin()
+{
+    return iterator(this);
+}
+
+/**
+ * @brief The end of the stream, which is never reached
+ */
+
+template<typename distT>
+statslib_inline
+typename sampler<distT>::iterator
+sampler<distT>::end()
+{
+    return iterator();
+}
+
+/**
+ * @brief Restart the stream from its first draw
+ */
+
+template<typename distT>
+statslib_inline
+void
+sampler<distT>::reset()
+{
+    engine_.seed(seed_val_);
+
+    block_vals_.resize(STATS_SAMPLER_BLOCK_SIZE);
+    block_pos_ = block_vals_.size();
+
+    n_draws_ = 0;
+}
+
+template<typename distT>
+statslib_inline
+void
+sampler<distT>::refill()
+{
+    dist_obj_.fill(engine_,block_vals_.data(),block_vals_.size());
+    block_pos_ = 0;
+}
+
+//
+// iterator
+
+template<typename distT>
+statslib_inline
+sampler<distT>::iterator::iterator(sampler* sampler_ptr)
+: sampler_ptr_(sampler_ptr), val_(sampler_ptr->next())
+{}
+
+template<typename distT>
+statslib_inline
+typename sampler<distT>::iterator::reference
+sampler<distT>::iterator::operator*()
+const
+{
+    return val_;
+}
+
+template<typename distT>
+statslib_inline
+typename sampler<distT>::iterator::pointer
+sampler<distT>::iterator::operator->()
+const
+{
+    return &val_;
+}
+
+template<typename distT>
+statslib_inline
+typename sampler<distT>::iterator&
+sampler<distT>::iterator::operator++()
+{
+    val_ = sampler_ptr_->next();
+    return *this;
+}
+
+template<typename distT>
+statslib_inline
+typename sampler<distT>::iterator
+sampler<distT>::iterator::operator++(int)
+{
+    iterator iter_copy = *this;
+    ++(*this);
+    return iter_copy;
+}
+
+template<typename distT>
+statslib_inline
+bool
+sampler<distT>::iterator::operator==(const iterator& rhs)
+const
+{
+    return sampler_ptr_ == rhs.sampler_ptr_;
+}
+
+template<typename distT>
+statslib_inline
+bool
+sampler<distT>::iterator::operator!=(const iterator& rhs)
+const
+{
+    return !(*this == rhs);
+}
@@ -0,0 +1,154 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * t distribution object
+ */
+
+/**
+ * @brief The t distribution, with fixed parameters
+ *
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ */
+
+statslib_inline
+t_dist::t_dist(const double dof_par)
+: dof_par_(dof_par)
+{
+    regular_ = internal::t_sanity_check(dof_par_) && GCINT::is_finite(dof_par_) && dof_par_ > 0.0;
+
+    log_mult_coef_ = - (0.5*dof_par_ + 0.5);
+    log_norm_const_ = stmath::lgamma(0.5*dof_par_ + 0.5) - 0.5*(stmath::log(dof_par_) + GCEM_LOG_PI) - stmath::lgamma(0.5*dof_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rt with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+t_dist::result_type
+t_dist::operator()(rngT& engine)
+const
+{
+    return rt(dof_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+t_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rt_vec(dof_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+t_dist::logpdf_compute(const double x)
+const
+{
+    return( log_norm_const_ + log_mult_coef_*std::log1p((x/dof_par_)*x) );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dt(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+t_dist::pdf(const double x)
+const
+{
+    if (regular_ && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dt(x,dof_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dt(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+t_dist::logpdf(const double x)
+const
+{
+    if (regular_ && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dt(x,dof_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pt(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+t_dist::cdf(const double x)
+const
+{
+    return pt(x,dof_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qt(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+t_dist::quantile(const double p)
+const
+{
+    return qt(p,dof_par_);
+}
@@ -0,0 +1,66 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * truncated Normal distribution object
+ */
+
+#ifndef _statslib_tnorm_dist_HPP
+#define _statslib_tnorm_dist_HPP
+
+/**
+ * @brief The truncated Normal distribution, with fixed parameters
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::tnorm_dist dist_obj(1.0,2.0,0.0,3.0);
+ * dist_obj(engine);
+ * \endcode
+ */
+
+class tnorm_dist : public dist_base<tnorm_dist>
+{
+    public:
+        using result_type = double;
+
+        tnorm_dist(const double mu_par, const double sigma_par, const double lower_par, const double upper_par);
+
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        result_type operator()(rngT& engine) const;
+
+    private:
+        friend class dist_base<tnorm_dist>;
+
+        template<typename rngT>
+        void fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals) const;
+
+        double mu_par_;
+        double sigma_par_;
+        double lower_par_;
+        double upper_par_;
+};
+
+//
+// include implementation files
+
+#include "tnorm_dist.ipp"
+
+#endif
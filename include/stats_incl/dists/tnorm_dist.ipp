@@ -0,0 +1,69 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * truncated Normal distribution object
+ */
+
+/**
+ * @brief The truncated Normal distribution, with fixed parameters
+ *
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ */
+
+statslib_inline
+tnorm_dist::tnorm_dist(const double mu_par, const double sigma_par, const double lower_par, const double upper_par)
+: mu_par_(mu_par), sigma_par_(sigma_par), lower_par_(lower_par), upper_par_(upper_par)
+{}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rtnorm with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+tnorm_dist::result_type
+tnorm_dist::operator()(rngT& engine)
+const
+{
+    return rtnorm(mu_par_,sigma_par_,lower_par_,upper_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+tnorm_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rtnorm_vec(mu_par_,sigma_par_,lower_par_,upper_par_,engine,vals_out,n_vals);
+}
+
+#endif
@@ -0,0 +1,165 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Uniform distribution object
+ */
+
+/**
+ * @brief The Uniform distribution, with fixed parameters
+ *
+ * @param a_par the lower bound parameter, a real-valued input.
+ * @param b_par the upper bound parameter, a real-valued input.
+ */
+
+statslib_inline
+unif_dist::unif_dist(const double a_par, const double b_par)
+: a_par_(a_par), b_par_(b_par)
+{
+    regular_ = internal::unif_sanity_check(a_par_,b_par_) && GCINT::all_finite(a_par_,b_par_) && a_par_ < b_par_;
+
+    inv_width_ = 1.0 / (b_par_ - a_par_);
+    log_norm_const_ = - stmath::log(b_par_ - a_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c runif with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+unif_dist::result_type
+unif_dist::operator()(rngT& engine)
+const
+{
+    return runif(a_par_,b_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+unif_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::runif_vec(a_par_,b_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+unif_dist::logpdf_compute(const double x)
+const
+{
+    STATS_UNUSED_PAR(x);
+
+    return log_norm_const_;
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dunif(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+unif_dist::pdf(const double x)
+const
+{
+    if (regular_ && x >= a_par_ && x <= b_par_) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dunif(x,a_par_,b_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dunif(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+unif_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x >= a_par_ && x <= b_par_) {
+        return logpdf_compute(x);
+    }
+
+    return dunif(x,a_par_,b_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>punif(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+unif_dist::cdf(const double x)
+const
+{
+    if (regular_ && !GCINT::is_nan(x)) {
+        return( x <= a_par_ ? 0.0 : x >= b_par_ ? 1.0 : (x - a_par_)*inv_width_ );
+    }
+
+    return punif(x,a_par_,b_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qunif(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+unif_dist::quantile(const double p)
+const
+{
+    if (regular_ && p > 0.0 && p < 1.0) {
+        return( a_par_ + p*(b_par_ - a_par_) );
+    }
+
+    return qunif(p,a_par_,b_par_);
+}
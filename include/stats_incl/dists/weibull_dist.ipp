@@ -0,0 +1,166 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Weibull distribution object
+ */
+
+/**
+ * @brief The Weibull distribution, with fixed parameters
+ *
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ */
+
+statslib_inline
+weibull_dist::weibull_dist(const double shape_par, const double scale_par)
+: shape_par_(shape_par), scale_par_(scale_par)
+{
+    regular_ = internal::weibull_sanity_check(shape_par_,scale_par_) && GCINT::all_finite(shape_par_,scale_par_) && shape_par_ > 0.0;
+
+    inv_scale_par_ = 1.0 / scale_par_;
+    inv_shape_par_ = 1.0 / shape_par_;
+    log_norm_const_ = stmath::log(shape_par_ / scale_par_);
+}
+
+/**
+ * @brief Draw from the distribution
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw, as from \c rweibull with the same engine.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+weibull_dist::result_type
+weibull_dist::operator()(rngT& engine)
+const
+{
+    return rweibull(shape_par_,scale_par_,engine);
+}
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk draws, behind dist_base::fill
+
+template<typename rngT>
+statslib_inline
+void
+weibull_dist::fill_vec(rngT& engine, result_type* vals_out, const ullint_t n_vals)
+const
+{
+    internal::rweibull_vec(shape_par_,scale_par_,engine,vals_out,n_vals);
+}
+
+#endif
+
+//
+// density, CDF, and quantile function
+
+statslib_inline
+double
+weibull_dist::logpdf_compute(const double x)
+const
+{
+    const double z = x*inv_scale_par_;
+
+    return( log_norm_const_ + (shape_par_ - 1.0)*std::log(z) - std::pow(z,shape_par_) );
+}
+
+/**
+ * @brief Density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the density function evaluated at \c x, as <tt>dweibull(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+weibull_dist::pdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return std::exp(logpdf_compute(x));
+    }
+
+    return dweibull(x,shape_par_,scale_par_,false);
+}
+
+/**
+ * @brief Log-density function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the log-density function evaluated at \c x, as <tt>dweibull(x,...,true)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+weibull_dist::logpdf(const double x)
+const
+{
+    if (regular_ && x > 0.0 && GCINT::is_finite(x)) {
+        return logpdf_compute(x);
+    }
+
+    return dweibull(x,shape_par_,scale_par_,true);
+}
+
+/**
+ * @brief Distribution function of the distribution
+ *
+ * @param x a real-valued input.
+ *
+ * @return the cumulative distribution function evaluated at \c x, as <tt>pweibull(x,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+weibull_dist::cdf(const double x)
+const
+{
+    if (regular_ && x >= STLIM<double>::epsilon() && GCINT::is_finite(x)) {
+        return( - std::expm1(- std::pow(x*inv_scale_par_,shape_par_)) );
+    }
+
+    return pweibull(x,shape_par_,scale_par_);
+}
+
+/**
+ * @brief Quantile function of the distribution
+ *
+ * @param p a real-valued input.
+ *
+ * @return the quantile function evaluated at \c p, as <tt>qweibull(p,...)</tt> with the same parameters.
+ */
+
+statslib_inline
+double
+weibull_dist::quantile(const double p)
+const
+{
+    if (regular_ && p > 0.0 && p < 1.0) {
+        return( scale_par_*std::pow(- std::log1p(-p), inv_shape_par_) );
+    }
+
+    return qweibull(p,shape_par_,scale_par_);
+}
@@ -0,0 +1,77 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Thread-local default random engine
+ */
+
+#ifndef _statslib_default_engine_HPP
+#define _statslib_default_engine_HPP
+
+namespace internal
+{
+
+// the default engine is created on first use in each thread and seeded
+// from std::random_device, unless stats::set_seed is called first
+
+statslib_inline
+xoshiro256pp&
+default_engine()
+{
+    static thread_local xoshiro256pp engine( (static_cast<ullint_t>(std::random_device{}()) << 32) ^ std::random_device{}() );
+
+    return engine;
+}
+
+// seed value for the seeded vector/matrix samplers when none is provided
+
+statslib_inline
+ullint_t
+default_seed()
+{
+    return default_engine()();
+}
+
+}
+
+/**
+ * @brief Seed the default random engine of the calling thread
+ *
+ * The sampling functions called without a seed value or engine draw from a thread-local
+ * default engine. Calling \c set_seed makes the subsequent draws of the calling thread reproducible;
+ * engines of other threads are not affected.
+ *
+ * @param seed_val a non-negative integral-valued seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::set_seed(1776);
+ * stats::rnorm(1.0,2.0);
+ * \endcode
+ */
+
+statslib_inline
+void
+set_seed(const ullint_t seed_val)
+{
+    internal::default_engine().seed(seed_val);
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Philox4x64-10 counter-based random engine (Salmon, Moraes, Dror, and Shaw, 2011)
+ */
+
+#ifndef _statslib_philox4x64_HPP
+#define _statslib_philox4x64_HPP
+
+/**
+ * @brief Philox4x64-10 counter-based random engine
+ *
+ * Each 256-bit counter value is mapped to four 64-bit outputs by a keyed bijection, so the
+ * engine can be advanced by any number of draws in constant time (\c discard). The key is set
+ * from the seed value, and the top 64 bits of the counter from the stream index: different
+ * streams with the same seed therefore cover disjoint counter ranges of length 2^194 draws.
+ *
+ * The engine state can be saved and restored using the stream operators, e.g., for checkpointing.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::philox4x64 engine(1776);
+ * stats::rnorm(1.0,2.0,engine);
+ * // independent substream 3 for the same seed
+ * stats::philox4x64 engine_3(1776,3);
+ * \endcode
+ */
+
+class philox4x64
+{
+    public:
+        using result_type = ullint_t;
+
+        static constexpr result_type min() { return result_type(0); }
+        static constexpr result_type max() { return ~result_type(0); }
+
+        explicit philox4x64(const result_type seed_val = result_type(1776), const ullint_t stream_ind = ullint_t(0));
+
+        void seed(const result_type seed_val = result_type(1776), const ullint_t stream_ind = ullint_t(0));
+
+        result_type operator()();
+
+        void discard(ullint_t n_skip);
+
+        friend statslib_inline bool operator==(const philox4x64& lhs, const philox4x64& rhs);
+
+        template<typename CharT, typename Traits>
+        friend std::basic_ostream<CharT,Traits>& operator<<(std::basic_ostream<CharT,Traits>& os, const philox4x64& engine);
+
+        template<typename CharT, typename Traits>
+        friend std::basic_istream<CharT,Traits>& operator>>(std::basic_istream<CharT,Traits>& is, philox4x64& engine);
+
+    private:
+        result_type key_[2];
+        result_type counter_[4]; // counter of the next block to be generated
+        result_type block_[4];   // current block of outputs
+        uint_t block_ind_;       // position in the current block; 4 if exhausted
+
+        void generate_block();
+        void increment_counter(const ullint_t n_blocks);
+};
+
+statslib_inline bool operator!=(const philox4x64& lhs, const philox4x64& rhs);
+
+//
+// include implementation files
+
+#include "philox4x64.ipp"
+
+#endif
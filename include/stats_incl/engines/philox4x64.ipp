@@ -0,0 +1,273 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Philox4x64-10 counter-based random engine (Salmon, Moraes, Dror, and Shaw, 2011)
+ */
+
+namespace internal
+{
+
+// high and low 64-bit words of a 64x64-bit product
+
+statslib_inline
+void
+mulhilo64(const ullint_t a, const ullint_t b, ullint_t& hi, ullint_t& lo)
+{
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 prod = static_cast<unsigned __int128>(a) * b;
+
+    hi = static_cast<ullint_t>(prod >> 64);
+    lo = static_cast<ullint_t>(prod);
+#else
+    const ullint_t mask_32 = 0xFFFFFFFFULL;
+
+    const ullint_t a_lo = a & mask_32, a_hi = a >> 32;
+    const ullint_t b_lo = b & mask_32, b_hi = b >> 32;
+
+    const ullint_t p_ll = a_lo * b_lo;
+    const ullint_t p_lh = a_lo * b_hi;
+    const ullint_t p_hl = a_hi * b_lo;
+    const ullint_t p_hh = a_hi * b_hi;
+
+    const ullint_t mid = (p_ll >> 32) + (p_lh & mask_32) + (p_hl & mask_32);
+
+    hi = p_hh + (p_lh >> 32) + (p_hl >> 32) + (mid >> 32);
+    lo = a * b;
+#endif
+}
+
+}
+
+statslib_inline
+philox4x64::philox4x64(const result_type seed_val, const ullint_t stream_ind)
+{
+    seed(seed_val,stream_ind);
+}
+
+statslib_inline
+void
+philox4x64::seed(const result_type seed_val, const ullint_t stream_ind)
+{
+    key_[0] = seed_val;
+    key_[1] = 0;
+
+    counter_[0] = 0;
+    counter_[1] = 0;
+    counter_[2] = 0;
+    counter_[3] = stream_ind;
+
+    block_ind_ = 4U;
+}
+
+statslib_inline
+void
+philox4x64::generate_block()
+{
+    const ullint_t mult_0 = 0xD2E7470EE14C6C93ULL;
+    const ullint_t mult_1 = 0xCA5A826395121157ULL;
+
+    const ullint_t weyl_0 = 0x9E3779B97F4A7C15ULL;
+    const ullint_t weyl_1 = 0xBB67AE8584CAA73BULL;
+
+    ullint_t ctr[4] = { counter_[0], counter_[1], counter_[2], counter_[3] };
+    ullint_t key[2] = { key_[0], key_[1] };
+
+    for (int r = 0; r < 10; ++r)
+    {
+        if (r > 0) {
+            key[0] += weyl_0;
+            key[1] += weyl_1;
+        }
+
+        ullint_t hi_0, lo_0, hi_1, lo_1;
+        internal::mulhilo64(mult_0, ctr[0], hi_0, lo_0);
+        internal::mulhilo64(mult_1, ctr[2], hi_1, lo_1);
+
+        ctr[0] = hi_1 ^ ctr[1] ^ key[0];
+        ctr[1] = lo_1;
+        ctr[2] = hi_0 ^ ctr[3] ^ key[1];
+        ctr[3] = lo_0;
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        block_[i] = ctr[i];
+    }
+}
+
+statslib_inline
+void
+philox4x64::increment_counter(const ullint_t n_blocks)
+{
+    counter_[0] += n_blocks;
+
+    if (counter_[0] < n_blocks) {                             // carry
+        for (int i = 1; i < 4; ++i) {
+            if (++counter_[i] != ullint_t(0)) {
+                break;
+            }
+        }
+    }
+}
+
+statslib_inline
+philox4x64::result_type
+philox4x64::operator()()
+{
+    if (block_ind_ == 4U)
+    {
+        generate_block();
+        increment_counter(1);
+        block_ind_ = 0U;
+    }
+
+    return block_[block_ind_++];
+}
+
+/**
+ * @brief Advance the engine by \c n_skip draws in constant time
+ */
+
+statslib_inline
+void
+philox4x64::discard(ullint_t n_skip)
+{
+    const ullint_t n_left = 4U - block_ind_;
+
+    if (n_skip <= n_left)
+    {
+        block_ind_ += static_cast<uint_t>(n_skip);
+        return;
+    }
+
+    n_skip -= n_left;
+
+    increment_counter(n_skip / 4U);
+
+    block_ind_ = 4U;
+
+    const uint_t n_rem = static_cast<uint_t>(n_skip % 4U);
+
+    if (n_rem > 0U)
+    {
+        generate_block();
+        increment_counter(1);
+        block_ind_ = n_rem;
+    }
+}
+
+//
+// comparison and state save/restore
+
+statslib_inline
+bool
+operator==(const philox4x64& lhs, const philox4x64& rhs)
+{
+    if (lhs.block_ind_ != rhs.block_ind_ || lhs.key_[0] != rhs.key_[0] || lhs.key_[1] != rhs.key_[1]) {
+        return false;
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        if (lhs.counter_[i] != rhs.counter_[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+statslib_inline
+bool
+operator!=(const philox4x64& lhs, const philox4x64& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits>& os, const philox4x64& engine)
+{
+    const typename std::basic_ostream<CharT,Traits>::fmtflags flags = os.flags();
+    const CharT fill = os.fill();
+
+    os.flags(std::ios_base::dec | std::ios_base::left);
+    os.fill(os.widen(' '));
+
+    os << engine.key_[0] << os.widen(' ') << engine.key_[1];
+
+    for (int i = 0; i < 4; ++i) {
+        os << os.widen(' ') << engine.counter_[i];
+    }
+
+    os << os.widen(' ') << engine.block_ind_;
+
+    os.flags(flags);
+    os.fill(fill);
+
+    return os;
+}
+
+template<typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits>& is, philox4x64& engine)
+{
+    const typename std::basic_istream<CharT,Traits>::fmtflags flags = is.flags();
+    is.flags(std::ios_base::dec | std::ios_base::skipws);
+
+    ullint_t key_in[2], counter_in[4];
+    uint_t block_ind_in;
+
+    is >> key_in[0] >> key_in[1] >> counter_in[0] >> counter_in[1] >> counter_in[2] >> counter_in[3] >> block_ind_in;
+
+    if (!is.fail() && block_ind_in <= 4U)
+    {
+        engine.key_[0] = key_in[0];
+        engine.key_[1] = key_in[1];
+
+        for (int i = 0; i < 4; ++i) {
+            engine.counter_[i] = counter_in[i];
+        }
+
+        // the buffered block is recomputed from the previous counter value
+
+        engine.block_ind_ = 4U;
+
+        if (block_ind_in < 4U)
+        {
+            ullint_t n_back = 1U;
+
+            for (int i = 0; i < 4; ++i) {
+                const bool borrow = (engine.counter_[i] < n_back);
+                engine.counter_[i] -= n_back;
+                n_back = borrow ? 1U : 0U;
+            }
+
+            engine.generate_block();
+            engine.increment_counter(1);
+            engine.block_ind_ = block_ind_in;
+        }
+    } else {
+        is.setstate(std::ios_base::failbit);
+    }
+
+    is.flags(flags);
+
+    return is;
+}
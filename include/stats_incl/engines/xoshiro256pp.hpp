@@ -0,0 +1,83 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * xoshiro256++ random engine (Blackman and Vigna, 2019)
+ */
+
+#ifndef _statslib_xoshiro256pp_HPP
+#define _statslib_xoshiro256pp_HPP
+
+/**
+ * @brief xoshiro256++ random engine
+ *
+ * A 64-bit engine with 256 bits of state and period 2^256 - 1. The \c jump() and \c long_jump()
+ * member functions advance the state by 2^128 and 2^192 draws, respectively, and can be used
+ * to generate non-overlapping sequences for parallel computations.
+ *
+ * The engine state can be saved and restored using the stream operators, e.g., for checkpointing.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::xoshiro256pp engine(1776);
+ * stats::rnorm(1.0,2.0,engine);
+ * \endcode
+ */
+
+class xoshiro256pp
+{
+    public:
+        using result_type = ullint_t;
+
+        static constexpr result_type min() { return result_type(0); }
+        static constexpr result_type max() { return ~result_type(0); }
+
+        explicit xoshiro256pp(const result_type seed_val = result_type(1776));
+
+        void seed(const result_type seed_val = result_type(1776));
+
+        result_type operator()();
+
+        void discard(ullint_t n_skip);
+        void jump();
+        void long_jump();
+
+        friend statslib_inline bool operator==(const xoshiro256pp& lhs, const xoshiro256pp& rhs);
+
+        template<typename CharT, typename Traits>
+        friend std::basic_ostream<CharT,Traits>& operator<<(std::basic_ostream<CharT,Traits>& os, const xoshiro256pp& engine);
+
+        template<typename CharT, typename Traits>
+        friend std::basic_istream<CharT,Traits>& operator>>(std::basic_istream<CharT,Traits>& is, xoshiro256pp& engine);
+
+    private:
+        result_type state_[4];
+
+        void jump_by(const result_type* jump_poly);
+};
+
+statslib_inline bool operator!=(const xoshiro256pp& lhs, const xoshiro256pp& rhs);
+
+//
+// include implementation files
+
+#include "xoshiro256pp.ipp"
+
+#endif
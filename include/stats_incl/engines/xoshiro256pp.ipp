@@ -0,0 +1,206 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * xoshiro256++ random engine (Blackman and Vigna, 2019)
+ */
+
+namespace internal
+{
+
+statslib_inline
+ullint_t
+rotl64(const ullint_t x, const int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+// SplitMix64 is used to expand a single seed value into a full engine state
+
+statslib_inline
+ullint_t
+splitmix64(ullint_t& x)
+{
+    ullint_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+}
+
+statslib_inline
+xoshiro256pp::xoshiro256pp(const result_type seed_val)
+{
+    seed(seed_val);
+}
+
+statslib_inline
+void
+xoshiro256pp::seed(const result_type seed_val)
+{
+    ullint_t sm_state = seed_val;
+
+    for (int i = 0; i < 4; ++i) {
+        state_[i] = internal::splitmix64(sm_state);
+    }
+}
+
+statslib_inline
+xoshiro256pp::result_type
+xoshiro256pp::operator()()
+{
+    const result_type ret = internal::rotl64(state_[0] + state_[3], 23) + state_[0];
+
+    const result_type t = state_[1] << 17;
+
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+
+    state_[2] ^= t;
+
+    state_[3] = internal::rotl64(state_[3], 45);
+
+    return ret;
+}
+
+statslib_inline
+void
+xoshiro256pp::discard(ullint_t n_skip)
+{
+    for (; n_skip > ullint_t(0); --n_skip) {
+        (*this)();
+    }
+}
+
+statslib_inline
+void
+xoshiro256pp::jump_by(const result_type* jump_poly)
+{
+    result_type s_new[4] = { 0, 0, 0, 0 };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int b = 0; b < 64; ++b)
+        {
+            if (jump_poly[i] & (result_type(1) << b))
+            {
+                s_new[0] ^= state_[0];
+                s_new[1] ^= state_[1];
+                s_new[2] ^= state_[2];
+                s_new[3] ^= state_[3];
+            }
+
+            (*this)();
+        }
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        state_[i] = s_new[i];
+    }
+}
+
+/**
+ * @brief Advance the engine by 2^128 draws; equivalent to 2^128 calls of \c operator()
+ */
+
+statslib_inline
+void
+xoshiro256pp::jump()
+{
+    static const result_type jump_poly[4] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 
+                                              0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+
+    jump_by(jump_poly);
+}
+
+/**
+ * @brief Advance the engine by 2^192 draws; equivalent to 2^192 calls of \c operator()
+ */
+
+statslib_inline
+void
+xoshiro256pp::long_jump()
+{
+    static const result_type jump_poly[4] = { 0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 
+                                              0x77710069854EE241ULL, 0x39109BB02ACBE635ULL };
+
+    jump_by(jump_poly);
+}
+
+//
+// comparison and state save/restore
+
+statslib_inline
+bool
+operator==(const xoshiro256pp& lhs, const xoshiro256pp& rhs)
+{
+    return (lhs.state_[0] == rhs.state_[0]) && (lhs.state_[1] == rhs.state_[1]) 
+        && (lhs.state_[2] == rhs.state_[2]) && (lhs.state_[3] == rhs.state_[3]);
+}
+
+statslib_inline
+bool
+operator!=(const xoshiro256pp& lhs, const xoshiro256pp& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<typename CharT, typename Traits>
+std::basic_ostream<CharT,Traits>&
+operator<<(std::basic_ostream<CharT,Traits>& os, const xoshiro256pp& engine)
+{
+    const typename std::basic_ostream<CharT,Traits>::fmtflags flags = os.flags();
+    const CharT fill = os.fill();
+
+    os.flags(std::ios_base::dec | std::ios_base::left);
+    os.fill(os.widen(' '));
+
+    os << engine.state_[0] << os.widen(' ') << engine.state_[1] << os.widen(' ')
+       << engine.state_[2] << os.widen(' ') << engine.state_[3];
+
+    os.flags(flags);
+    os.fill(fill);
+
+    return os;
+}
+
+template<typename CharT, typename Traits>
+std::basic_istream<CharT,Traits>&
+operator>>(std::basic_istream<CharT,Traits>& is, xoshiro256pp& engine)
+{
+    const typename std::basic_istream<CharT,Traits>::fmtflags flags = is.flags();
+    is.flags(std::ios_base::dec | std::ios_base::skipws);
+
+    ullint_t state_in[4];
+    is >> state_in[0] >> state_in[1] >> state_in[2] >> state_in[3];
+
+    if (!is.fail()) {
+        for (int i = 0; i < 4; ++i) {
+            engine.state_[i] = state_in[i];
+        }
+    }
+
+    is.flags(flags);
+
+    return is;
+}
@@ -0,0 +1,253 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * branch-free math kernels over arrays of doubles, written so that the compiler can vectorize them
+ */
+
+#ifndef _statslib_batch_math_HPP
+#define _statslib_batch_math_HPP
+
+// the kernels process their input in groups of STATS_BATCH_MATH_WIDTH values, and the
+// number of values must be a multiple of it; the fixed-length inner loops are vectorized
+// even under conservative cost models (e.g., GCC at -O2)
+
+#ifndef STATS_BATCH_MATH_WIDTH
+    #define STATS_BATCH_MATH_WIDTH ullint_t(8)
+#endif
+
+namespace internal
+{
+
+statslib_inline
+ullint_t
+batch_double_bits(const double x)
+{
+    ullint_t ret;
+    std::memcpy(&ret,&x,sizeof(double));
+    return ret;
+}
+
+statslib_inline
+double
+batch_bits_double(const ullint_t x)
+{
+    double ret;
+    std::memcpy(&ret,&x,sizeof(double));
+    return ret;
+}
+
+// bit-wise select of a where mask is all ones and b where it is zero; with integer masks and both
+// operands computed unconditionally, the loops stay free of branches under the default
+// (trapping) floating-point model, which otherwise blocks their vectorization
+
+statslib_inline
+double
+batch_select(const ullint_t mask, const double a, const double b)
+{
+    return batch_bits_double((batch_double_bits(a) & mask) | (batch_double_bits(b) & ~mask));
+}
+
+// natural logarithm, in place; x = 2^k m with m in [sqrt(2)/2, sqrt(2)), and log(m) follows the
+// fdlibm polynomial (error < 1 ulp). Subnormal inputs are first scaled by 2^54; zero, negative and
+// non-finite inputs give the values of std::log (-inf, NaN, and inf or NaN)
+
+statslib_inline
+void
+batch_log(double* __stats_pointer_settings__ vals, const ullint_t n_vals)
+{
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+
+    const double Lg1 = 6.666666666666735130e-01;
+    const double Lg2 = 3.999999999940941908e-01;
+    const double Lg3 = 2.857142874366239149e-01;
+    const double Lg4 = 2.222219843214978396e-01;
+    const double Lg5 = 1.818357216161805012e-01;
+    const double Lg6 = 1.531383769920937332e-01;
+    const double Lg7 = 1.479819860511658591e-01;
+
+    for (ullint_t j_0=ullint_t(0); j_0 < n_vals; j_0 += STATS_BATCH_MATH_WIDTH)
+    {
+        double* __stats_pointer_settings__ vals_chunk = vals + j_0;
+
+        STATS_SIMD_LOOP
+        for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+        {
+            const double x_in = vals_chunk[j];
+
+            const ullint_t x_in_bits = batch_double_bits(x_in);
+            const ullint_t x_abs_bits = x_in_bits & ullint_t(0x7FFFFFFFFFFFFFFF);
+
+            // 1 if |x| is subnormal (or zero), in which case x is scaled by 2^54
+
+            const ullint_t x_subnormal = (x_abs_bits - ullint_t(0x0010000000000000)) >> 63;
+
+            const ullint_t x_bits = batch_double_bits(batch_select(ullint_t(0) - x_subnormal, x_in*18014398509481984.0, x_in));
+            const ullint_t m_bits = x_bits & ullint_t(0x000FFFFFFFFFFFFF);
+
+            // 1 if the significand exceeds sqrt(2) (bits 0x6A09E667F3BCD), in which case m is halved
+
+            const ullint_t m_adj = (m_bits + ullint_t(0x0010000000000000 - 0x6A09E667F3BCD - 1)) >> 52;
+
+            const double m = batch_bits_double(m_bits | ((ullint_t(0x3FF) - m_adj) << 52));
+
+            // the unbiased exponent without an integer conversion: (2^52 + e) - 2^52 - 1023
+
+            const double k = (batch_bits_double((((x_bits >> 52) & ullint_t(0x7FF)) + m_adj) | ullint_t(0x4330000000000000)) - 4503599627370496.0)
+                                - 1023.0 - 54.0*static_cast<double>(x_subnormal);
+            const double f = m - 1.0;
+
+            const double s = f / (2.0 + f);
+            const double z = s*s;
+            const double w = z*z;
+
+            const double R = z*(Lg1 + w*(Lg3 + w*(Lg5 + w*Lg7))) + w*(Lg2 + w*(Lg4 + w*Lg6));
+            const double hfsq = 0.5*f*f;
+
+            const double log_x = k*ln2_hi - ((hfsq - (s*(hfsq + R) + k*ln2_lo)) - f);
+
+            // special cases: zero (-inf), negative (NaN), and inf or NaN (returned as is)
+
+            const ullint_t x_zero = (x_abs_bits - ullint_t(1)) >> 63;
+            const ullint_t x_neg = (x_in_bits >> 63) & (ullint_t(1) - x_zero);
+            const ullint_t x_nonfinite = (x_abs_bits + (ullint_t(0x8000000000000000) - ullint_t(0x7FF0000000000000))) >> 63;
+
+            const double special_val = batch_select(ullint_t(0) - x_zero, - STLIM<double>::infinity(),
+                                                    batch_select(ullint_t(0) - x_neg, STLIM<double>::quiet_NaN(), x_in));
+
+            vals_chunk[j] = batch_select(ullint_t(0) - (x_zero | x_neg | x_nonfinite), special_val, log_x);
+        }
+    }
+}
+
+// exponential, in place; x = n log(2) + r with |r| <= log(2)/2, exp(r) by its Taylor series to
+// degree 13, and 2^n applied in two factors (each within the normal range for |n| <= 1077) so
+// that subnormal results and overflow are handled.
+// Integer rounding uses the 1.5 * 2^52 shift, so this kernel must not be compiled with
+// reassociating optimizations such as -ffast-math
+
+statslib_inline
+void
+batch_exp(double* __stats_pointer_settings__ vals, const ullint_t n_vals)
+{
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+    const double log2_e = 1.44269504088896338700e+00;
+
+    const double round_shift = 6755399441055744.0;
+
+    for (ullint_t j_0=ullint_t(0); j_0 < n_vals; j_0 += STATS_BATCH_MATH_WIDTH)
+    {
+        double* __stats_pointer_settings__ vals_chunk = vals + j_0;
+
+        STATS_SIMD_LOOP
+        for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+        {
+            const double x_in = vals_chunk[j];
+
+            // clamp to |x| <= 746, beyond which the result is 0 or inf anyway (NaN is left as is);
+            // the bit patterns of |x| order as the values
+
+            const ullint_t x_abs_bits = batch_double_bits(x_in) & ullint_t(0x7FFFFFFFFFFFFFFF);
+
+            const ullint_t x_large = (x_abs_bits + (ullint_t(0x8000000000000000) - batch_double_bits(746.0) - ullint_t(1))) >> 63;
+            const ullint_t x_nan = (x_abs_bits + (ullint_t(0x8000000000000000) - ullint_t(0x7FF0000000000000) - ullint_t(1))) >> 63;
+
+            const double x = batch_select(ullint_t(0) - (x_large - x_nan), std::copysign(746.0,x_in), x_in);
+
+            // round to the nearest integer by adding 1.5 * 2^52: the sum keeps n in its low-order bits
+
+            const double n_shift = x*log2_e + round_shift;
+            const double dn = n_shift - round_shift;
+
+            const double r = (x - dn*ln2_hi) - dn*ln2_lo;
+
+            double p = 1.0 + r*(1.0/13.0);
+            p = 1.0 + r*(1.0/12.0)*p;
+            p = 1.0 + r*(1.0/11.0)*p;
+            p = 1.0 + r*(1.0/10.0)*p;
+            p = 1.0 + r*(1.0/9.0)*p;
+            p = 1.0 + r*(1.0/8.0)*p;
+            p = 1.0 + r*(1.0/7.0)*p;
+            p = 1.0 + r*(1.0/6.0)*p;
+            p = 1.0 + r*(1.0/5.0)*p;
+            p = 1.0 + r*(1.0/4.0)*p;
+            p = 1.0 + r*(1.0/3.0)*p;
+            p = 1.0 + r*(1.0/2.0)*p;
+            p = 1.0 + r*p;
+
+            const double n_1_shift = 0.5*dn + round_shift;
+            const double n_2_shift = (dn - (n_1_shift - round_shift)) + round_shift;
+
+            const double scale_1 = batch_bits_double((batch_double_bits(n_1_shift) + ullint_t(1023)) << 52);
+            const double scale_2 = batch_bits_double((batch_double_bits(n_2_shift) + ullint_t(1023)) << 52);
+
+            vals_chunk[j] = p*scale_1*scale_2;
+        }
+    }
+}
+
+// tan(pi x), in place, for |x| < 1/2; |x| > 1/4 is reflected through tan(pi x) = 1 / tan(pi (1/2 - x)),
+// and tan(y) on [0, pi/4] uses the Cephes rational approximation
+
+statslib_inline
+void
+batch_tanpi(double* __stats_pointer_settings__ vals, const ullint_t n_vals)
+{
+    const double P0 = -1.30936939181383777646e+04;
+    const double P1 =  1.15351664838587416140e+06;
+    const double P2 = -1.79565251976484877988e+07;
+
+    const double Q0 =  1.36812963470692954678e+04;
+    const double Q1 = -1.32089234440210967447e+06;
+    const double Q2 =  2.50083801823357915839e+07;
+    const double Q3 = -5.38695755929454629881e+07;
+
+    const double pi = 3.14159265358979323846;
+
+    for (ullint_t j_0=ullint_t(0); j_0 < n_vals; j_0 += STATS_BATCH_MATH_WIDTH)
+    {
+        double* __stats_pointer_settings__ vals_chunk = vals + j_0;
+
+        STATS_SIMD_LOOP
+        for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+        {
+            const double x = vals_chunk[j];
+            const double x_abs = std::fabs(x);
+
+            // all ones if |x| > 1/4 (positive doubles order as their bit patterns)
+
+            const ullint_t reflect_mask = ullint_t(0) - ((batch_double_bits(x_abs) + (ullint_t(0x8000000000000000) - batch_double_bits(0.25) - ullint_t(1))) >> 63);
+
+            const double y = pi * batch_select(reflect_mask, 0.5 - x_abs, x_abs); // 1/2 - |x| is exact
+            const double z = y*y;
+
+            const double tan_y = y + y*(z*((P0*z + P1)*z + P2) / ((((z + Q0)*z + Q1)*z + Q2)*z + Q3));
+            const double tan_abs = batch_select(reflect_mask, 1.0 / tan_y, tan_y);
+
+            vals_chunk[j] = std::copysign(tan_abs,x);
+        }
+    }
+}
+
+}
+
+#endif
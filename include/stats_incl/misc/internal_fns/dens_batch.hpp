@@ -0,0 +1,113 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * batched evaluation of density and distribution functions over arrays
+ */
+
+#ifndef _statslib_dens_batch_HPP
+#define _statslib_dens_batch_HPP
+
+namespace internal
+{
+
+// The inputs are copied, in double precision, into batches of STATS_DENS_BATCH_SIZE values;
+// inputs for which fast_in(x) is false (NaN, infinities, points outside the interior of the
+// support) are replaced by x_safe. batch_fn(x_vals, vals, n) then computes the function over
+// the whole batch, typically through the kernels of batch_math.hpp, and n is padded to a
+// multiple of STATS_BATCH_MATH_WIDTH. A second, masked pass overwrites the replaced inputs
+// with the output of scalar_fn, so that special values follow the scalar functions.
+// Output types wider than double are left to scalar_fn.
+
+template<typename eT, typename rT, typename inFnT, typename batchFnT, typename scalarFnT>
+statslib_inline
+void
+dens_batch_eval(const eT* __stats_pointer_settings__ vals_in, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, 
+                const double x_safe, const inFnT& fast_in, const batchFnT& batch_fn, const scalarFnT& scalar_fn)
+{
+    if (sizeof(rT) > sizeof(double))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = scalar_fn(vals_in[j]);
+        }
+
+        return;
+    }
+
+    const ullint_t n_batches = (num_elem + ullint_t(STATS_DENS_BATCH_SIZE) - ullint_t(1)) / ullint_t(STATS_DENS_BATCH_SIZE);
+
+#ifdef STATS_USE_OPENMP
+    #pragma omp parallel for if(n_batches > STATS_OMP_N_BLOCKS)
+#endif
+    for (ullint_t k=ullint_t(0); k < n_batches; ++k)
+    {
+        double x_vals[STATS_DENS_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+        double batch_vals[STATS_DENS_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+        bool fast_flag[STATS_DENS_BATCH_SIZE];
+
+        const ullint_t j = k*ullint_t(STATS_DENS_BATCH_SIZE);
+        const ullint_t n_batch = (num_elem - j < ullint_t(STATS_DENS_BATCH_SIZE)) ? num_elem - j : ullint_t(STATS_DENS_BATCH_SIZE);
+        const ullint_t n_padded = (n_batch + STATS_BATCH_MATH_WIDTH - ullint_t(1)) / STATS_BATCH_MATH_WIDTH * STATS_BATCH_MATH_WIDTH;
+
+        for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+            x_vals[i] = static_cast<double>(vals_in[j + i]);
+        }
+
+        for (ullint_t i=n_batch; i < n_padded; ++i) {
+            x_vals[i] = x_safe;
+        }
+
+        ullint_t n_slow = ullint_t(0);
+
+        for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+            fast_flag[i] = fast_in(x_vals[i]);
+            n_slow += !fast_flag[i];
+        }
+
+        if (n_slow > ullint_t(0))
+        {
+            for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+                x_vals[i] = fast_flag[i] ? x_vals[i] : x_safe;
+            }
+        }
+
+        batch_fn(x_vals,batch_vals,n_padded);
+
+        for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+            vals_out[j + i] = static_cast<rT>(batch_vals[i]);
+        }
+
+        // fix-up pass
+
+        if (n_slow > ullint_t(0))
+        {
+            for (ullint_t i=ullint_t(0); i < n_batch; ++i)
+            {
+                if (!fast_flag[i]) {
+                    vals_out[j + i] = scalar_fn(vals_in[j + i]);
+                }
+            }
+        }
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,289 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * runtime kernel for the regularized incomplete beta function
+ */
+
+#ifndef _statslib_incomplete_beta_kernel_HPP
+#define _statslib_incomplete_beta_kernel_HPP
+
+namespace internal
+{
+
+// Regularized incomplete beta function I_x(a,b), and its complement I_y(b,a) = 1 - I_x(a,b) with y = 1 - x,
+// in double precision, for a, b > 0. Callers pass both x and y, so that the side close to 1 does not lose
+// accuracy to the subtraction (e.g., y = t^2/(dof + t^2) for the t distribution).
+//
+// As in Didonato and Morris (1992, TOMS 708), the arguments are first arranged so that x <= 1/2, swapping
+// (a,x) and (b,y) if needed, and then:
+//   b <= 1 or b x <= 0.7  : the power series x^a/B(a,b) (1/a + sum_{j >= 1} (1-b)...(j-b)/j! x^j/(a+j));
+//   otherwise             : the continued fraction of TOMS 708's bfrac, for I_x(a,b) when x <= a/(a+b),
+//                           and for I_y(b,a) beyond.
+// With D(a,b,x) = x^a y^b / B(a,b), log D is computed directly. For a, b >= 20, it is formed as
+// a log1pmx(x/x_0 - 1) + b log1pmx(y/y_0 - 1) + log(sqrt(ab/(2 pi (a+b))) Gamma^*(a+b)/(Gamma^*(a) Gamma^*(b))),
+// with x_0 = a/(a+b) and y_0 = b/(a+b), which avoids the cancellation between a log(x) + b log(y) and
+// lbeta(a,b); when only one of a and b is large, lbeta is formed from the Stirling series of that one.
+// log1pmx and the Stirling series are shared with incomplete_gamma_kernel.hpp.
+//
+// lbeta(a,b) and the parameter-only parts of the regime selection are collected in an ibeta_pars_t, so
+// that batch_ibeta evaluates many points with shared parameters at the cost of one setup.
+
+#define STATS_IBETA_LARGE_PAR 20.0
+#define STATS_IBETA_SERIES_BOUND 0.7
+#define STATS_IBETA_MAX_ITER 10000
+
+struct ibeta_pars_t
+{
+    double a;
+    double b;
+    double log_beta;        // lbeta(a,b), used unless both a, b >= STATS_IBETA_LARGE_PAR
+    double log_pre_cons;    // log(sqrt(ab/(2 pi (a+b))) Gamma^*(a+b)/(Gamma^*(a) Gamma^*(b))), used otherwise
+    double x_mean;          // a/(a+b) and b/(a+b); the continued fraction is used on the side below the mean
+    double y_mean;
+    double x_series;        // the power series in x is used for x <= x_series, and in y for y <= y_series
+    double y_series;
+    bool large_pars;
+};
+
+statslib_inline
+double
+ibeta_log_beta(const double a, const double b)
+{
+    const double par_lo = std::min(a,b);
+    const double par_hi = std::max(a,b);
+
+    if (par_hi < STATS_IBETA_LARGE_PAR) {
+        return std::lgamma(a) + std::lgamma(b) - std::lgamma(a + b);
+    }
+
+    // lgamma(par_hi) - lgamma(par_lo + par_hi), through the Stirling series
+
+    return( std::lgamma(par_lo) - par_lo*std::log(par_lo + par_hi) - (par_hi - 0.5)*std::log1p(par_lo / par_hi) + par_lo
+                + igamma_log_gamma_star(par_hi) - igamma_log_gamma_star(par_lo + par_hi) );
+}
+
+statslib_inline
+ibeta_pars_t
+ibeta_pars(const double a, const double b)
+{
+    ibeta_pars_t pars;
+
+    pars.a = a;
+    pars.b = b;
+    pars.large_pars = (std::min(a,b) >= STATS_IBETA_LARGE_PAR);
+
+    pars.log_beta = pars.large_pars ? 0.0 : ibeta_log_beta(a,b);
+    pars.log_pre_cons = pars.large_pars ? 0.5*(std::log(a) + std::log(b) - std::log(a + b) - GCEM_LOG_2PI)
+                                            + igamma_log_gamma_star(a + b) - igamma_log_gamma_star(a) - igamma_log_gamma_star(b) : 0.0;
+
+    pars.x_mean = a / (a + b);
+    pars.y_mean = b / (a + b);
+
+    pars.x_series = b <= 1.0 ? 0.5 : std::min(0.5, STATS_IBETA_SERIES_BOUND / b);
+    pars.y_series = a <= 1.0 ? 0.5 : std::min(0.5, STATS_IBETA_SERIES_BOUND / a);
+
+    return pars;
+}
+
+statslib_inline
+double
+ibeta_log_prefactor(const ibeta_pars_t& pars, const double x, const double y, const double log_x, const double log_y)
+{   // log D(a,b,x), which is symmetric in (a,x) and (b,y)
+    if (!pars.large_pars) {
+        return pars.a*log_x + pars.b*log_y - pars.log_beta;
+    }
+
+    // x - x_0 = y_0 - y, taken on the side that is at most 1/2
+
+    const double x_dev = x <= 0.5 ? x - pars.x_mean : pars.y_mean - y;
+
+    return( pars.a*igamma_log1pmx(x_dev / pars.x_mean, x / pars.x_mean)
+            + pars.b*igamma_log1pmx(- x_dev / pars.y_mean, y / pars.y_mean) + pars.log_pre_cons );
+}
+
+statslib_inline
+double
+ibeta_series(const double a, const double b, const double x)
+{   // I_x(a,b) = D(a,b,x) / y^b * series
+    double coef = 1.0;
+    double sum = 1.0 / a;
+
+    for (int j=1; j < STATS_IBETA_MAX_ITER; ++j)
+    {
+        coef *= (j - b) * x / j;
+        const double term = coef / (a + j);
+        sum += term;
+
+        if (std::abs(term) <= sum*STLIM<double>::epsilon()) {
+            break;
+        }
+    }
+
+    return sum;
+}
+
+statslib_inline
+double
+ibeta_cont_frac(const double a, const double b, const double x, const double y)
+{   // I_x(a,b) = D(a,b,x) * cont_frac, for x <= a/(a+b); the fraction is written in terms of
+    // lambda = a - (a+b) x = (a+b) y - b, which is formed from y when a > b, as in TOMS 708's bfrac
+    const double lambda = a > b ? (a + b)*y - b : a - (a + b)*x;
+
+    const double c = lambda + 1.0;
+    const double c_0 = b / a;
+    const double c_1 = 1.0 / a + 1.0;
+    const double y_p1 = y + 1.0;
+
+    double p = 1.0;
+    double s = a + 1.0;
+
+    double a_n = 0.0;
+    double b_n = 1.0;
+    double a_np1 = 1.0;
+    double b_np1 = c / c_1;
+
+    double r = c_1 / c;
+
+    for (int n=1; n < STATS_IBETA_MAX_ITER; ++n)
+    {
+        const double t = n / a;
+        const double w = n * (b - n) * x;
+        const double inv_s = 1.0 / s;
+
+        const double e_a = a * inv_s;
+        const double alpha = p * (p + c_0) * e_a * e_a * (w * x);
+        const double e_b = (t + 1.0) / (c_1 + t + t);
+        const double beta = n + w * inv_s + e_b * (c + n * y_p1);
+
+        p = t + 1.0;
+        s += 2.0;
+
+        const double a_tmp = alpha * a_n + beta * a_np1;
+        const double inv_b_tmp = 1.0 / (alpha * b_n + beta * b_np1);
+
+        const double r_prev = r;
+        r = a_tmp * inv_b_tmp;
+
+        if (std::abs(r - r_prev) <= STLIM<double>::epsilon() * r) {
+            break;
+        }
+
+        // rescale
+
+        a_n = a_np1 * inv_b_tmp;
+        b_n = b_np1 * inv_b_tmp;
+        a_np1 = r;
+        b_np1 = 1.0;
+    }
+
+    return r;
+}
+
+/**
+ * @brief Regularized incomplete beta function, with shared parameters
+ *
+ * @param pars the output of \c ibeta_pars(a,b), with \c a, \c b > 0 and finite.
+ * @param x a real-valued input in [0,1].
+ * @param y equal to 1 - \c x, which the caller may be able to compute more accurately.
+ * @param upper return 1 - I_x(a,b) = I_y(b,a) instead of I_x(a,b).
+ * @param log_form return the log of the probability.
+ */
+
+statslib_inline
+double
+ibeta_kernel(const ibeta_pars_t& pars, const double x, const double y, const bool upper, const bool log_form)
+{
+    if (x <= 0.0 || y <= 0.0) {
+        return log_if((x > 0.0) != upper ? 1.0 : 0.0, log_form);
+    }
+
+    // arrange x <= 1/2, then pick the series or the continued fraction; lower_tail records
+    // whether the value computed is I_x(a,b) or its complement
+
+    const bool swap_xy = (x > 0.5);
+
+    const double a_s = swap_xy ? pars.b : pars.a;
+    const double b_s = swap_xy ? pars.a : pars.b;
+    const double x_s = swap_xy ? y : x;
+    const double y_s = swap_xy ? x : y;
+
+    // with a large, I_x(a,b) is sensitive to the rounding of x near one, so the log of the side
+    // above 1/2 is formed from the other side, which is held to full relative precision
+
+    const double log_x_s = std::log(x_s);
+    const double log_y_s = std::log1p(-x_s);
+
+    const double log_pre = swap_xy ? ibeta_log_prefactor(pars,y_s,x_s,log_y_s,log_x_s) :
+                                     ibeta_log_prefactor(pars,x_s,y_s,log_x_s,log_y_s);
+
+    bool lower_tail = !swap_xy;
+    double log_val;
+
+    if (x_s <= (swap_xy ? pars.y_series : pars.x_series)) {
+        log_val = log_pre - b_s*log_y_s + std::log(ibeta_series(a_s,b_s,x_s));
+    } else if (x_s <= (swap_xy ? pars.y_mean : pars.x_mean)) {
+        log_val = log_pre + std::log(ibeta_cont_frac(a_s,b_s,x_s,y_s));
+    } else {
+        log_val = log_pre + std::log(ibeta_cont_frac(b_s,a_s,y_s,x_s));
+        lower_tail = !lower_tail;
+    }
+
+    if (lower_tail != upper) {
+        return log_form ? log_val : std::exp(log_val);
+    }
+
+    const double val = std::exp(log_val);
+
+    return log_form ? std::log1p(-val) : 1.0 - val;
+}
+
+statslib_inline
+double
+ibeta_kernel(const double a, const double b, const double x, const double y, const bool upper, const bool log_form)
+{
+    return ibeta_kernel(ibeta_pars(a,b),x,y,upper,log_form);
+}
+
+/**
+ * @brief Regularized incomplete beta function over an array, with shared parameters
+ *
+ * @param pars the output of \c ibeta_pars(a,b), with \c a, \c b > 0 and finite.
+ * @param x_vals a pointer to \c n_vals inputs in [0,1].
+ * @param y_vals a pointer to the \c n_vals values of 1 - \c x.
+ * @param vals a pointer to \c n_vals values, overwritten with I_x(a,b) or 1 - I_x(a,b).
+ * @param n_vals the number of inputs.
+ * @param upper compute 1 - I_x(a,b) instead of I_x(a,b).
+ * @param log_form compute the log of the probabilities.
+ */
+
+statslib_inline
+void
+batch_ibeta(const ibeta_pars_t& pars, const double* __stats_pointer_settings__ x_vals, const double* __stats_pointer_settings__ y_vals,
+            double* __stats_pointer_settings__ vals, const ullint_t n_vals, const bool upper, const bool log_form)
+{
+    for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+        vals[j] = ibeta_kernel(pars,x_vals[j],y_vals[j],upper,log_form);
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,402 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * runtime kernel for the regularized incomplete gamma function
+ */
+
+#ifndef _statslib_incomplete_gamma_kernel_HPP
+#define _statslib_incomplete_gamma_kernel_HPP
+
+namespace internal
+{
+
+// Regularized incomplete gamma functions P(a,x) and Q(a,x) = 1 - P(a,x), in double precision,
+// for a > 0 and x >= 0. With D(a,x) = x^a exp(-x) / Gamma(a), the regimes are:
+//   a >= 20 and |x - a| <= 0.3 a : Temme's uniform asymptotic expansion (Temme, 1979; DLMF 8.12),
+//                                  Q = erfc(eta sqrt(a/2))/2 + exp(-a eta^2/2) / sqrt(2 pi a) sum_k c_k(eta) / a^k,
+//                                  where eta^2/2 = x/a - 1 - log(x/a), with c_0, ..., c_10 as Taylor polynomials in eta;
+//   x < a + 1                    : P = D(a,x)/a * sum_{n >= 0} x^n / ((a+1)...(a+n));
+//   otherwise                    : Q = D(a,x) times Legendre's continued fraction, by the modified Lentz method.
+// log D(a,x) is computed directly; for a >= 20, it is formed as a (log(1+mu) - mu) + log(sqrt(a/(2 pi)) / Gamma^*(a)),
+// with mu = (x - a)/a and Gamma^*(a) the Stirling series, which avoids the cancellation in a log(x) - x - lgamma(a).
+// The log-probabilities are returned without a round-trip through exp, so that they stay finite in the far tails;
+// the tail opposite to the one computed is formed as 1 - v (or log1p(-v)).
+//
+// The shape-dependent terms (lgamma(a), the Stirling series and the regime boundaries) are collected in an
+// igamma_shape_t, so that batch_igamma evaluates many points with a shared shape parameter at the cost
+// of one setup. These functions use loops, and are not constexpr; see STATS_USE_RUNTIME_KERNEL.
+
+#define STATS_IGAMMA_TEMME_MIN_SHAPE 20.0
+#define STATS_IGAMMA_TEMME_MAX_DIST 0.3
+#define STATS_IGAMMA_ERFC_TAIL 26.0   // erfc() underflows shortly beyond this point
+#define STATS_IGAMMA_MAX_ITER 10000
+#define STATS_IGAMMA_TEMME_N_COEF 18
+
+struct igamma_shape_t
+{
+    double a;
+    double inv_a;
+    double log_a;
+    double log_gamma_a;     // lgamma(a), used below STATS_IGAMMA_TEMME_MIN_SHAPE
+    double log_pre_cons;    // log(sqrt(a/(2 pi)) / Gamma^*(a)), used above
+    double sqrt_half_a;
+    double x_temme_lower;
+    double x_temme_upper;
+    double temme_coef[STATS_IGAMMA_TEMME_N_COEF];  // sum_k c_k(eta) / a^k / sqrt(2 pi a), as a polynomial in eta
+    bool large_shape;
+};
+
+// log(Gamma^*(a)) = lgamma(a) - (a - 1/2) log(a) + a - log(2 pi)/2, for a >= 20
+
+statslib_inline
+double
+igamma_log_gamma_star(const double a)
+{
+    const double inv_a = 1.0 / a;
+    const double inv_a_sq = inv_a*inv_a;
+
+    return inv_a*(1.0/12.0 + inv_a_sq*(-1.0/360.0 + inv_a_sq*(1.0/1260.0 + inv_a_sq*(-1.0/1680.0
+                + inv_a_sq*(1.0/1188.0 + inv_a_sq*(-691.0/360360.0 + inv_a_sq/156.0))))));
+}
+
+// Temme's coefficients c_k(eta), k = 0, ..., 10, truncated for |eta| <= 0.34 (|mu| <= 0.3) and a >= 20;
+// the constant terms are -1/3, -1/540, 25/6048, ... For a given shape, sum_k c_k(eta) / a^k is collapsed
+// into a single polynomial in eta.
+
+statslib_inline
+void
+igamma_temme_coef(const double inv_a, const double scale_term, double* coef_out)
+{
+    static const double c_0[18] = {
+        -0.33333333333333331, 0.083333333333333329, -0.014814814814814815, 0.0011574074074074073,
+        0.00035273368606701942, -0.0001787551440329218, 3.9192631785224377e-05, -2.185448510679992e-06,
+        -1.85406221071516e-06, 8.2967113409530865e-07, -1.7665952736826078e-07, 6.7078535434014984e-09,
+        1.0261809784240309e-08, -4.3820360184533529e-09, 9.1476995822367902e-10,
+        -2.5514193994946248e-11, -5.8307721325504256e-11, 2.4361948020667415e-11 };
+    static const double c_1[16] = {
+        -0.0018518518518518519, -0.003472222222222222, 0.0026455026455026454, -0.00099022633744855963,
+        0.00020576131687242798, -4.018775720164609e-07, -1.8098550334489977e-05,
+        7.6491609160811098e-06, -1.6120900894563446e-06, 4.647127802807434e-09, 1.3786334469157209e-07,
+        -5.7525456035177047e-08, 1.1951628599778148e-08, -1.7543241719747647e-11,
+        -1.0091543710600413e-09, 4.1627929918425828e-10 };
+    static const double c_2[15] = {
+        0.0041335978835978834, -0.0026813271604938273, 0.0007716049382716049, 2.0093878600823047e-06,
+        -0.0001073665322636516, 5.2923448829120125e-05, -1.2760635188618728e-05,
+        3.4235787340961378e-08, 1.3721957309062934e-06, -6.2989921383800548e-07,
+        1.4280614206064242e-07, -2.0477098421990866e-10, -1.409252991086752e-08,
+        6.2289740849220218e-09, -1.3670488396617114e-09 };
+    static const double c_3[13] = {
+        0.00064943415637860077, 0.00022947209362139917, -0.0004691894943952557, 0.00026772063206283885,
+        -7.5618016718839766e-05, -2.3965051138672968e-07, 1.1082654115347302e-05,
+        -5.6749528269915965e-06, 1.4230900732435883e-06, -2.7861080291528143e-11,
+        -1.6958404091930278e-07, 8.0994649053880827e-08, -1.9111168485973655e-08 };
+    static const double c_4[13] = {
+        -0.00086188829091671173, 0.00078403922172006662, -0.00029907248030319018,
+        -1.4638452578843418e-06, 6.6414982154651219e-05, -3.9683650471794347e-05,
+        1.1375726970678419e-05, 2.5074972262375329e-10, -1.6954149536558305e-06,
+        8.9075075322053094e-07, -2.2929348340008049e-07, 2.9567941375440492e-11, 2.8865829742708783e-08 };
+    static const double c_5[12] = {
+        -0.00033679855336635813, -6.9728137583658571e-05, 0.00027727532449593918,
+        -0.00019932570516188847, 6.797780477937208e-05, 1.4190629206439671e-07,
+        -1.3594048189768693e-05, 8.018470256334202e-06, -2.2914811765080952e-06,
+        -3.2524735512984538e-10, 3.4652846491085265e-07, -1.8447187191171344e-07 };
+    static const double c_6[10] = {
+        0.00053130793646399225, -0.00059216643735369393, 0.0002708782096718045, 7.9023532326603281e-07,
+        -8.1539693675619691e-05, 5.6116827531062497e-05, -1.8329116582843375e-05,
+        -3.0796134506033047e-09, 3.4651553688036091e-06, -2.0291327396058603e-06 };
+    static const double c_7[9] = {
+        0.00034436760689237765, 5.1717909082605919e-05, -0.00033493161081142234,
+        0.00028126951547632369, -0.00010976582244684731, -1.2741009095484485e-07,
+        2.7744451511563645e-05, -1.8263488805711332e-05, 5.7876949497350525e-06 };
+    static const double c_8[7] = {
+        -0.00065262391859530937, 0.00083949872067208726, -0.00043829709854172099,
+        -6.9690914584205523e-07, 0.00016644846642067547, -0.00012783517679769218, 4.6299532636913042e-05 };
+    static const double c_9[7] = {
+        -0.00059676129019274626, -7.2048954160200109e-05, 0.0006782308837667328,
+        -0.0006401475260262758, 0.00027750107634328704, 1.8197008380465151e-07, -8.4795071170685031e-05 };
+    static const double c_10[5] = {
+        0.0013324454494800656, -0.0019144384985654776, 0.0011089369134596636, 9.9324041226422995e-07,
+        -0.00050874501293093194 };
+
+
+    static const double* const coef[11] = { c_0, c_1, c_2, c_3, c_4, c_5, c_6, c_7, c_8, c_9, c_10 };
+    static const int n_coef[11] = { 18, 16, 15, 13, 13, 12, 10, 9, 7, 7, 5 };
+
+    for (int i=0; i < STATS_IGAMMA_TEMME_N_COEF; ++i) {
+        coef_out[i] = 0.0;
+    }
+
+    for (int k=10; k >= 0; --k)
+    {
+        for (int i=0; i < STATS_IGAMMA_TEMME_N_COEF; ++i) {
+            coef_out[i] *= inv_a;
+        }
+
+        for (int i=0; i < n_coef[k]; ++i) {
+            coef_out[i] += coef[k][i];
+        }
+    }
+
+    for (int i=0; i < STATS_IGAMMA_TEMME_N_COEF; ++i) {
+        coef_out[i] *= scale_term;
+    }
+}
+
+statslib_inline
+igamma_shape_t
+igamma_shape(const double a)
+{
+    igamma_shape_t shape;
+
+    shape.a = a;
+    shape.inv_a = 1.0 / a;
+    shape.log_a = std::log(a);
+    shape.large_shape = (a >= STATS_IGAMMA_TEMME_MIN_SHAPE);
+
+    shape.log_gamma_a = shape.large_shape ? 0.0 : std::lgamma(a);
+    shape.log_pre_cons = shape.large_shape ? 0.5*(shape.log_a - GCEM_LOG_2PI) - igamma_log_gamma_star(a) : 0.0;
+
+    shape.sqrt_half_a = std::sqrt(0.5*a);
+
+    if (shape.large_shape) {
+        igamma_temme_coef(shape.inv_a,1.0 / std::sqrt(2.0*GCEM_PI*a),shape.temme_coef);
+    }
+
+    shape.x_temme_lower = shape.large_shape ? a - STATS_IGAMMA_TEMME_MAX_DIST*a : 0.0;
+    shape.x_temme_upper = shape.large_shape ? a + STATS_IGAMMA_TEMME_MAX_DIST*a : -1.0;
+
+    return shape;
+}
+
+// log(1 + mu) - mu; for |mu| < 1/2, with t = mu/(2 + mu): -mu t + 2 t^3 (1/3 + t^2/5 + t^4/7 + ...).
+// Otherwise log(ratio) - mu, where ratio = 1 + mu is formed directly from the inputs (e.g., x/a), as the
+// difference of two logs (log x - log a) would lose about a*eps in absolute terms once multiplied by a.
+
+statslib_inline
+double
+igamma_log1pmx(const double mu, const double ratio)
+{
+    if (std::abs(mu) >= 0.5) {
+        return std::log(ratio) - mu;
+    }
+
+    const double t = mu / (2.0 + mu);
+    const double t_sq = t*t; // <= 1/9
+
+    const double sum = 1.0/3.0 + t_sq*(1.0/5.0 + t_sq*(1.0/7.0 + t_sq*(1.0/9.0 + t_sq*(1.0/11.0
+                + t_sq*(1.0/13.0 + t_sq*(1.0/15.0 + t_sq*(1.0/17.0 + t_sq*(1.0/19.0 + t_sq*(1.0/21.0
+                + t_sq*(1.0/23.0 + t_sq*(1.0/25.0 + t_sq*(1.0/27.0 + t_sq*(1.0/29.0 + t_sq*(1.0/31.0
+                + t_sq*(1.0/33.0 + t_sq*(1.0/35.0))))))))))))))));
+
+    return - mu*t + 2.0*t*t_sq*sum;
+}
+
+statslib_inline
+double
+igamma_log_prefactor(const igamma_shape_t& shape, const double x)
+{   // log D(a,x)
+    if (!shape.large_shape) {
+        return shape.a*std::log(x) - x - shape.log_gamma_a;
+    }
+
+    const double mu = (x - shape.a)*shape.inv_a;
+
+    return shape.a*igamma_log1pmx(mu,x / shape.a) + shape.log_pre_cons;
+}
+
+statslib_inline
+double
+igamma_series(const igamma_shape_t& shape, const double x)
+{   // P(a,x) = D(a,x) * series / a
+    double term = 1.0;
+    double sum = 1.0;
+
+    for (int n=1; n < STATS_IGAMMA_MAX_ITER; ++n)
+    {
+        term *= x / (shape.a + n);
+        sum += term;
+
+        if (term < sum*STLIM<double>::epsilon()) {
+            break;
+        }
+    }
+
+    return sum * shape.inv_a;
+}
+
+statslib_inline
+double
+igamma_cont_frac(const igamma_shape_t& shape, const double x)
+{   // Q(a,x) = D(a,x) * (1/(x+1-a- 1(1-a)/(x+3-a- 2(2-a)/(x+5-a- ...))))
+    const double tiny = STLIM<double>::min();
+
+    double b = x + 1.0 - shape.a;
+    double c = 1.0 / tiny;
+    double d = 1.0 / b;
+    double h = d;
+
+    for (int i=1; i < STATS_IGAMMA_MAX_ITER; ++i)
+    {
+        const double a_i = - i*(i - shape.a);
+        b += 2.0;
+
+        d = a_i*d + b;
+        d = std::abs(d) < tiny ? tiny : d;
+        c = b + a_i/c;
+        c = std::abs(c) < tiny ? tiny : c;
+
+        d = 1.0 / d;
+        const double del = d*c;
+        h *= del;
+
+        if (std::abs(del - 1.0) < STLIM<double>::epsilon()) {
+            break;
+        }
+    }
+
+    return h;
+}
+
+statslib_inline
+double
+igamma_temme_poly(const double* coef, const int n_coef, const double eta)
+{
+    double val = coef[n_coef - 1];
+
+    for (int i = n_coef - 2; i >= 0; --i) {
+        val = val*eta + coef[i];
+    }
+
+    return val;
+}
+
+// exp(z^2) erfc(z), for z >= STATS_IGAMMA_ERFC_TAIL
+
+statslib_inline
+double
+igamma_erfcx_tail(const double z)
+{
+    const double inv_2z_sq = 0.5 / (z*z);
+
+    double term = 1.0;
+    double sum = 1.0;
+
+    for (int k=1; k < 10; ++k)
+    {
+        term *= - (2*k - 1) * inv_2z_sq;
+        sum += term;
+    }
+
+    return sum * 0.564189583547756286948 / z; // 1/sqrt(pi)
+}
+
+statslib_inline
+double
+igamma_temme(const igamma_shape_t& shape, const double x, const bool upper, const bool log_form)
+{
+    const double mu = (x - shape.a)*shape.inv_a;
+    const double log1pmx = igamma_log1pmx(mu,1.0 + mu); // = - eta^2/2; here |mu| < 1/2
+
+    const double eta = (mu < 0.0 ? -1.0 : 1.0) * std::sqrt(-2.0*log1pmx);
+
+    // the smaller of the two tails (Q for eta > 0) is computed, and the other as its complement
+
+    const bool small_upper = (eta > 0.0);
+    const double z = std::abs(eta)*shape.sqrt_half_a;
+    const double r_term = (small_upper ? 1.0 : -1.0) * igamma_temme_poly(shape.temme_coef,STATS_IGAMMA_TEMME_N_COEF,eta);
+
+    if (small_upper != upper) {
+        const double val = 0.5*std::erfc(z) + std::exp(shape.a*log1pmx)*r_term;
+        return log_form ? std::log1p(-val) : 1.0 - val;
+    }
+
+    if (log_form && z > STATS_IGAMMA_ERFC_TAIL) {
+        return shape.a*log1pmx + std::log(0.5*igamma_erfcx_tail(z) + r_term);
+    }
+
+    const double val = 0.5*std::erfc(z) + std::exp(shape.a*log1pmx)*r_term;
+
+    return log_form ? std::log(val) : val;
+}
+
+/**
+ * @brief Regularized incomplete gamma function, with a shared shape parameter
+ *
+ * @param shape the output of \c igamma_shape(a), with \c a > 0 and finite.
+ * @param x a real-valued input, \c x >= 0 (possibly \c +Inf).
+ * @param upper return Q(a,x) instead of P(a,x).
+ * @param log_form return the log of the probability.
+ */
+
+statslib_inline
+double
+igamma_kernel(const igamma_shape_t& shape, const double x, const bool upper, const bool log_form)
+{
+    if (x <= 0.0 || GCINT::is_posinf(x)) {
+        return log_if((x > 0.0) != upper ? 1.0 : 0.0, log_form);
+    }
+
+    if (x >= shape.x_temme_lower && x <= shape.x_temme_upper) {
+        return igamma_temme(shape,x,upper,log_form);
+    }
+
+    const bool lower_tail = (x < shape.a + 1.0);
+    const double log_pre = igamma_log_prefactor(shape,x);
+    const double mult = lower_tail ? igamma_series(shape,x) : igamma_cont_frac(shape,x);
+
+    if (lower_tail != upper) {
+        return log_form ? log_pre + std::log(mult) : std::exp(log_pre)*mult;
+    }
+
+    const double val = std::exp(log_pre)*mult;
+
+    return log_form ? std::log1p(-val) : 1.0 - val;
+}
+
+statslib_inline
+double
+igamma_kernel(const double a, const double x, const bool upper, const bool log_form)
+{
+    return igamma_kernel(igamma_shape(a),x,upper,log_form);
+}
+
+/**
+ * @brief Regularized incomplete gamma function over an array, with a shared shape parameter
+ *
+ * @param shape the output of \c igamma_shape(a), with \c a > 0 and finite.
+ * @param vals a pointer to \c n_vals inputs (\c x >= 0), overwritten with P(a,x) or Q(a,x).
+ * @param n_vals the number of inputs.
+ * @param upper compute Q(a,x) instead of P(a,x).
+ * @param log_form compute the log of the probabilities.
+ */
+
+statslib_inline
+void
+batch_igamma(const igamma_shape_t& shape, double* __stats_pointer_settings__ vals, const ullint_t n_vals, const bool upper, const bool log_form)
+{
+    for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+        vals[j] = igamma_kernel(shape,vals[j],upper,log_form);
+    }
+}
+
+}
+
+#endif
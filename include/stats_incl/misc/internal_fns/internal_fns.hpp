@@ -21,9 +21,20 @@
 #ifndef _statslib_internal_fns_HPP
 #define _statslib_internal_fns_HPP
 
+#include "stmath.hpp"
+
 #include "log_if.hpp"
 #include "exp_if.hpp"
 
+#include "batch_math.hpp"
+#include "dens_batch.hpp"
+#include "pnorm_kernel.hpp"
+#include "qnorm_kernel.hpp"
+#include "incomplete_gamma_kernel.hpp"
+#include "incomplete_beta_kernel.hpp"
+#include "rand_bits.hpp"
+#include "rand_substream.hpp"
+
 #include "statslib_defs.hpp"
 
 #endif
@@ -0,0 +1,315 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Cody's rational approximations of the standard Normal distribution function
+ */
+
+#ifndef _statslib_pnorm_kernel_HPP
+#define _statslib_pnorm_kernel_HPP
+
+namespace internal
+{
+
+// W. J. Cody's rational Chebyshev approximations (Cody, 1969; ANORM in TOMS 715), as in R's
+// pnorm_both. The standard Normal CDF is evaluated on three intervals of |z|:
+//   |z| <= 0.67448975 : 0.5 + z R_1(z^2);
+//   |z| <= sqrt(32)   : exp(-z^2/2) R_2(|z|), the upper-tail probability;
+//   |z| >  sqrt(32)   : exp(-z^2/2) (1/sqrt(2 pi) - R_3(1/z^2)/z^2) / |z|.
+// exp(-z^2/2) is computed as exp(-z_16^2/2) exp(-(z - z_16)(z + z_16)/2), with z_16 = |z| rounded
+// down to a multiple of 1/16 (so that z_16^2 is exact), which keeps full relative accuracy in the
+// tails. The log-CDF is formed directly from -z^2/2 + log(R), so that it stays accurate (and finite)
+// far below the point where the CDF itself underflows.
+//
+// The scalar functions only use stmath::exp, log and log1p, and so are evaluated with gcem at
+// compile time and with <cmath> at run time.
+
+#define STATS_PNORM_CODY_SPLIT_1 0.67448975
+#define STATS_PNORM_CODY_SPLIT_2 5.656854249492380195206754896838 // sqrt(32)
+#define STATS_PNORM_CODY_INV_SQRT_2PI 0.398942280401432677939946059934
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_num_1(const T zsq)
+noexcept
+{
+    return( (((T(0.065682337918207449113)*zsq + T(2.2352520354606839287))*zsq + T(161.02823106855587881))*zsq
+                + T(1067.6894854603709582))*zsq + T(18154.981253343561249) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_den_1(const T zsq)
+noexcept
+{
+    return( (((zsq + T(47.20258190468824187))*zsq + T(976.09855173777669322))*zsq + T(10260.932208618978205))*zsq
+                + T(45507.789335026729956) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_num_2(const T y)
+noexcept
+{
+    return( (((((((T(1.0765576773720192317e-8)*y + T(0.39894151208813466764))*y + T(8.8831497943883759412))*y
+                + T(93.506656132177855979))*y + T(597.27027639480026226))*y + T(2494.5375852903726711))*y
+                + T(6848.1904505362823326))*y + T(11602.651437647350124))*y + T(9842.7148383839780218) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_den_2(const T y)
+noexcept
+{
+    return( (((((((y + T(22.266688044328115691))*y + T(235.38790178262499861))*y + T(1519.377599407554805))*y
+                + T(6485.558298266760755))*y + T(18615.571640885098091))*y + T(34900.952721145977266))*y
+                + T(38912.003286093271411))*y + T(19685.429676859990727) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_num_3(const T ysq_inv)
+noexcept
+{
+    return( ((((T(0.02307344176494017303)*ysq_inv + T(0.21589853405795699))*ysq_inv + T(0.1274011611602473639))*ysq_inv
+                + T(0.022235277870649807))*ysq_inv + T(0.001421619193227893466))*ysq_inv + T(2.9112874951168792e-5) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_den_3(const T ysq_inv)
+noexcept
+{
+    return( ((((ysq_inv + T(1.28426009614491121))*ysq_inv + T(0.468238212480865118))*ysq_inv
+                + T(0.0659881378689285515))*ysq_inv + T(0.00378239633202758244))*ysq_inv + T(7.29751555083966205e-5) );
+}
+
+// R_2(|z|) or the tail ratio, for |z| > 0.67448975
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_ratio(const T y)
+noexcept
+{
+    return( y <= T(STATS_PNORM_CODY_SPLIT_2) ? \
+                pnorm_cody_num_2(y) / pnorm_cody_den_2(y) :
+            //
+                (T(STATS_PNORM_CODY_INV_SQRT_2PI) - pnorm_cody_num_3(T(1)/(y*y)) / (y*y*pnorm_cody_den_3(T(1)/(y*y)))) / y );
+}
+
+// |z| rounded down to a multiple of 1/16; beyond 1e6 the split is irrelevant (exp(-z^2/2) underflows)
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_y_16(const T y)
+noexcept
+{
+    return( y < T(1e6) ? T(static_cast<llint_t>(T(16)*y)) / T(16) : y );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_upper(const T y, const T y_16, const T rat_val)
+noexcept
+{
+    return( stmath::exp(- T(0.5)*y_16*y_16) * stmath::exp(- T(0.5)*(y - y_16)*(y + y_16)) * rat_val );
+}
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody_tails(const T z, const T y, const T y_16, const T rat_val, const bool log_form)
+noexcept
+{
+    return( z < T(0) ? \
+                // lower tail
+                log_form ? - T(0.5)*y_16*y_16 - T(0.5)*(y - y_16)*(y + y_16) + stmath::log(rat_val) :
+                           pnorm_cody_upper(y,y_16,rat_val) :
+            // upper tail
+            log_form ? stmath::log1p(- pnorm_cody_upper(y,y_16,rat_val)) :
+                       T(1) - pnorm_cody_upper(y,y_16,rat_val) );
+}
+
+// Normal CDF (or its log) at a finite z
+
+template<typename T>
+statslib_constexpr
+T
+pnorm_cody(const T z, const bool log_form)
+noexcept
+{
+    return( stmath::abs(z) <= T(STATS_PNORM_CODY_SPLIT_1) ? \
+                log_if(T(0.5) + z * pnorm_cody_num_1(z*z) / pnorm_cody_den_1(z*z), log_form) :
+            //
+            pnorm_cody_tails(z,stmath::abs(z),pnorm_cody_y_16(stmath::abs(z)),pnorm_cody_ratio(stmath::abs(z)),log_form) );
+}
+
+// Normal CDF (or its log), in place, over standardized values with |z| < 1e150 (so that z^2 and
+// the tail ratio stay finite and normal); NaN and infinite values are left to the scalar functions.
+// The three rational functions are evaluated for every value (with arguments clamped to their own
+// interval) and the selected ratio takes a single division; exp(-z^2/2) takes a single exponential,
+// with the rounding error of -z_16^2/2 - del/2 applied as a first-order correction.
+
+statslib_inline
+void
+batch_pnorm(double* __stats_pointer_settings__ vals, const ullint_t n_vals, const bool log_form)
+{
+    const double split_1 = STATS_PNORM_CODY_SPLIT_1;
+    const double split_2 = STATS_PNORM_CODY_SPLIT_2;
+
+    const double round_shift = 6755399441055744.0;
+
+    double rat_vals[STATS_BATCH_MATH_WIDTH];
+    double exp_vals[STATS_BATCH_MATH_WIDTH];
+    double exp_corr[STATS_BATCH_MATH_WIDTH];
+    double log_vals[STATS_BATCH_MATH_WIDTH];
+
+    for (ullint_t j_0=ullint_t(0); j_0 < n_vals; j_0 += STATS_BATCH_MATH_WIDTH)
+    {
+        double* __stats_pointer_settings__ vals_chunk = vals + j_0;
+
+        STATS_SIMD_LOOP
+        for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+        {
+            const double z = vals_chunk[j];
+            const double y = std::fabs(z);
+
+            // all ones if |z| exceeds the split point (positive doubles order as their bit patterns)
+
+            const ullint_t y_bits = batch_double_bits(y);
+
+            const ullint_t mid_mask  = ullint_t(0) - ((y_bits + (ullint_t(0x8000000000000000) - batch_double_bits(split_1) - ullint_t(1))) >> 63);
+            const ullint_t tail_mask = ullint_t(0) - ((y_bits + (ullint_t(0x8000000000000000) - batch_double_bits(split_2) - ullint_t(1))) >> 63);
+            const ullint_t far_mask  = ullint_t(0) - ((y_bits + (ullint_t(0x8000000000000000) - batch_double_bits(40.0) - ullint_t(1))) >> 63);
+
+            // z R_1(z^2)
+
+            const double z_a = batch_select(mid_mask, 0.0, z);
+            const double zsq = z_a*z_a;
+
+            const double num_a = z_a * pnorm_cody_num_1(zsq);
+            const double den_a = pnorm_cody_den_1(zsq);
+
+            // R_2(|z|)
+
+            const double y_b = batch_select(tail_mask, split_2, y);
+
+            const double num_b = pnorm_cody_num_2(y_b);
+            const double den_b = pnorm_cody_den_2(y_b);
+
+            // (1/sqrt(2 pi) - R_3(1/z^2)/z^2) / |z|
+
+            const double y_c = batch_select(tail_mask, y, split_2);
+            const double ysq_inv = 1.0 / (y_c*y_c);
+
+            const double num_c = pnorm_cody_num_3(ysq_inv);
+            const double den_c = pnorm_cody_den_3(ysq_inv);
+
+            rat_vals[j] = batch_select(mid_mask, batch_select(tail_mask, STATS_PNORM_CODY_INV_SQRT_2PI*den_c - ysq_inv*num_c, num_b), num_a)
+                            / batch_select(mid_mask, batch_select(tail_mask, den_c*y_c, den_b), den_a);
+
+            // -z^2/2 = e_1 + e_2, with e_1 exact; their rounded sum, and its error by Knuth's two-sum.
+            // Beyond |z| = 40 the tail probability underflows in any case
+
+            const double y_e = batch_select(far_mask, 40.0, y);
+            const double y_16 = ((16.0*y_e + round_shift) - round_shift) * 0.0625;
+
+            const double e_1 = - 0.5*y_16*y_16;
+            const double e_2 = - 0.5*(y_e - y_16)*(y_e + y_16);
+
+            const double e_sum = e_1 + e_2;
+            const double e_virt = e_sum - e_1;
+
+            exp_vals[j] = e_sum;
+            exp_corr[j] = 1.0 + ((e_1 - (e_sum - e_virt)) + (e_2 - e_virt));
+        }
+
+        batch_exp(exp_vals,STATS_BATCH_MATH_WIDTH);
+
+        if (!log_form)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+            {
+                const double z = vals_chunk[j];
+
+                const ullint_t mid_mask = ullint_t(0) - ((batch_double_bits(std::fabs(z)) + (ullint_t(0x8000000000000000) - batch_double_bits(split_1) - ullint_t(1))) >> 63);
+                const ullint_t neg_mask = ullint_t(0) - (batch_double_bits(z) >> 63);
+
+                const double upper_val = exp_vals[j] * exp_corr[j] * rat_vals[j];
+
+                vals_chunk[j] = batch_select(mid_mask, batch_select(neg_mask, upper_val, 1.0 - upper_val), 0.5 + rat_vals[j]);
+            }
+
+            continue;
+        }
+
+        // log form: the log is taken of the central value, of the tail ratio (lower tail), or of
+        // 1 - Q (upper tail), all in [2e-151, 1]
+
+        STATS_SIMD_LOOP
+        for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+        {
+            const double z = vals_chunk[j];
+
+            const ullint_t mid_mask = ullint_t(0) - ((batch_double_bits(std::fabs(z)) + (ullint_t(0x8000000000000000) - batch_double_bits(split_1) - ullint_t(1))) >> 63);
+            const ullint_t neg_mask = ullint_t(0) - (batch_double_bits(z) >> 63);
+
+            exp_vals[j] *= exp_corr[j] * rat_vals[j]; // upper-tail probability Q
+
+            log_vals[j] = batch_select(mid_mask, batch_select(neg_mask, rat_vals[j], 1.0 - exp_vals[j]), 0.5 + rat_vals[j]);
+        }
+
+        batch_log(log_vals,STATS_BATCH_MATH_WIDTH);
+
+        STATS_SIMD_LOOP
+        for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+        {
+            const double z = vals_chunk[j];
+
+            const ullint_t mid_mask = ullint_t(0) - ((batch_double_bits(std::fabs(z)) + (ullint_t(0x8000000000000000) - batch_double_bits(split_1) - ullint_t(1))) >> 63);
+            const ullint_t neg_mask = ullint_t(0) - (batch_double_bits(z) >> 63);
+
+            // log1p(-Q) = log(u) (-Q) / (u - 1) with u = 1 - Q, which is exact to rounding unless u == 1
+
+            const double upper_val = exp_vals[j];
+            const double u = 1.0 - upper_val;
+
+            const ullint_t one_mask = ullint_t(0) - ullint_t(batch_double_bits(u) == batch_double_bits(1.0));
+
+            const double log1p_val = batch_select(one_mask, - upper_val, log_vals[j] * (- upper_val) / (u - 1.0));
+
+            vals_chunk[j] = batch_select(mid_mask, batch_select(neg_mask, log_vals[j] - 0.5*z*z, log1p_val), log_vals[j]);
+        }
+    }
+}
+
+}
+
+#endif
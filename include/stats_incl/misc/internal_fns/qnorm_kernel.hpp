@@ -0,0 +1,272 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Wichura's AS241 rational approximations of the standard Normal quantile function
+ */
+
+#ifndef _statslib_qnorm_kernel_HPP
+#define _statslib_qnorm_kernel_HPP
+
+namespace internal
+{
+
+// Algorithm AS241 (PPND16; Wichura, 1988), accurate to about 1e-16. With q = p - 1/2:
+//   |q| <= 0.425 : q R_1(0.180625 - q^2);
+//   otherwise, with r = sqrt(-log(min(p, 1-p))), sign(q) R_2(r - 1.6) for r <= 5,
+//   and sign(q) R_3(r - 5) beyond.
+//
+// As with pnorm_kernel.hpp, the scalar functions only use stmath::log and sqrt, and so are
+// evaluated with gcem at compile time and with <cmath> at run time.
+
+#define STATS_QNORM_AS241_SPLIT_1 0.425
+#define STATS_QNORM_AS241_SPLIT_2 5.0
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241_num_1(const T r)
+noexcept
+{
+    return( ((((((T(2509.0809287301226727)*r + T(33430.575583588128105))*r + T(67265.770927008700853))*r
+                + T(45921.953931549871457))*r + T(13731.693765509461125))*r + T(1971.5909503065514427))*r
+                + T(133.14166789178437745))*r + T(3.387132872796366608) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241_den_1(const T r)
+noexcept
+{
+    return( ((((((T(5226.495278852545925)*r + T(28729.085735721942674))*r + T(39307.89580009271061))*r
+                + T(21213.794301586595867))*r + T(5394.1960214247511077))*r + T(687.1870074920579083))*r
+                + T(42.313330701600911252))*r + T(1) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241_num_2(const T r)
+noexcept
+{
+    return( ((((((T(7.7454501427834140764e-4)*r + T(0.0227238449892691845833))*r + T(0.24178072517745061177))*r
+                + T(1.27045825245236838258))*r + T(3.64784832476320460504))*r + T(5.7694972214606914055))*r
+                + T(4.6303378461565452959))*r + T(1.42343711074968357734) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241_den_2(const T r)
+noexcept
+{
+    return( ((((((T(1.05075007164441684324e-9)*r + T(5.475938084995344946e-4))*r + T(0.0151986665636164571966))*r
+                + T(0.14810397642748007459))*r + T(0.68976733498510000455))*r + T(1.6763848301838038494))*r
+                + T(2.05319162663775882187))*r + T(1) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241_num_3(const T r)
+noexcept
+{
+    return( ((((((T(2.01033439929228813265e-7)*r + T(2.71155556874348757815e-5))*r + T(0.0012426609473880784386))*r
+                + T(0.026532189526576123093))*r + T(0.29656057182850489123))*r + T(1.7848265399172913358))*r
+                + T(5.4637849111641143699))*r + T(6.6579046435011037772) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241_den_3(const T r)
+noexcept
+{
+    return( ((((((T(2.04426310338993978564e-15)*r + T(1.4215117583164458887e-7))*r + T(1.8463183175100546818e-5))*r
+                + T(7.868691311456132591e-4))*r + T(0.0148753612908506148525))*r + T(0.13692988092273580531))*r
+                + T(0.59983220655588793769))*r + T(1) );
+}
+
+// |quantile| for r = sqrt(-log(min(p, 1-p)))
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241_tail(const T r)
+noexcept
+{
+    return( r <= T(STATS_QNORM_AS241_SPLIT_2) ? \
+                qnorm_as241_num_2(r - T(1.6)) / qnorm_as241_den_2(r - T(1.6)) :
+                qnorm_as241_num_3(r - T(5)) / qnorm_as241_den_3(r - T(5)) );
+}
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241_compute(const T p, const T q)
+noexcept
+{
+    return( stmath::abs(q) <= T(STATS_QNORM_AS241_SPLIT_1) ? \
+                q * qnorm_as241_num_1(T(0.180625) - q*q) / qnorm_as241_den_1(T(0.180625) - q*q) :
+            q < T(0) ? \
+                - qnorm_as241_tail(stmath::sqrt(- stmath::log(p))) :
+                  qnorm_as241_tail(stmath::sqrt(- stmath::log(T(1) - p))) );
+}
+
+// standard Normal quantile at p in (0,1)
+
+template<typename T>
+statslib_constexpr
+T
+qnorm_as241(const T p)
+noexcept
+{
+    return qnorm_as241_compute(p, p - T(0.5));
+}
+
+// standard Normal quantile, in place, over probabilities in [DBL_MIN, 1), so that log(min(p, 1-p))
+// is that of a positive, normal value; as in batch_math.hpp, the number of values must be a
+// multiple of STATS_BATCH_MATH_WIDTH (and so must STATS_QNORM_BLOCK_SIZE).
+// The central interval (|p - 1/2| <= 0.425, 85% of uniformly distributed probabilities) costs a
+// single rational function, and the tails a log, a square root, and another rational function;
+// evaluating both for every value would triple the cost. Instead, the central approximation is
+// computed over the whole block, the tail values are compacted into a second array (without
+// branches), evaluated there, and written back.
+
+#ifndef STATS_QNORM_BLOCK_SIZE
+    #define STATS_QNORM_BLOCK_SIZE ullint_t(64)
+#endif
+
+statslib_inline
+void
+batch_qnorm(double* __stats_pointer_settings__ vals, const ullint_t n_vals)
+{
+    const double split_1 = STATS_QNORM_AS241_SPLIT_1;
+    const double split_2 = STATS_QNORM_AS241_SPLIT_2;
+
+    double tail_vals[STATS_QNORM_BLOCK_SIZE + STATS_BATCH_MATH_WIDTH];
+    double tail_sign[STATS_QNORM_BLOCK_SIZE];
+    ullint_t tail_ind[STATS_QNORM_BLOCK_SIZE];
+
+    for (ullint_t j_0=ullint_t(0); j_0 < n_vals; j_0 += STATS_QNORM_BLOCK_SIZE)
+    {
+        double* __stats_pointer_settings__ vals_block = vals + j_0;
+
+        const ullint_t n_block = (n_vals - j_0 < STATS_QNORM_BLOCK_SIZE) ? n_vals - j_0 : STATS_QNORM_BLOCK_SIZE;
+
+        // compact the tail values: min(p, 1-p) and the sign of p - 1/2. For p < 1/2, p itself is
+        // used, as p - 1/2 is rounded; for p >= 1/2, 1 - p is exact
+
+        ullint_t n_tail = ullint_t(0);
+
+        for (ullint_t j=ullint_t(0); j < n_block; ++j)
+        {
+            const double p = vals_block[j];
+            const double q = p - 0.5;
+
+            const ullint_t neg_mask = ullint_t(0) - (batch_double_bits(q) >> 63);
+
+            tail_vals[n_tail] = batch_select(neg_mask, p, 1.0 - p);
+            tail_sign[n_tail] = std::copysign(1.0,q);
+            tail_ind[n_tail] = j;
+
+            n_tail += ullint_t(std::fabs(q) > split_1);
+        }
+
+        // q R_1(0.180625 - q^2); tail values are overwritten below
+
+        for (ullint_t j_1=ullint_t(0); j_1 < n_block; j_1 += STATS_BATCH_MATH_WIDTH)
+        {
+            double* __stats_pointer_settings__ vals_chunk = vals_block + j_1;
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+            {
+                const double q = vals_chunk[j] - 0.5;
+
+                // all ones if |q| exceeds the split point (positive doubles order as their bit patterns)
+
+                const ullint_t tail_mask = ullint_t(0) - ((batch_double_bits(std::fabs(q)) + (ullint_t(0x8000000000000000) - batch_double_bits(split_1) - ullint_t(1))) >> 63);
+
+                const double q_a = batch_select(tail_mask, 0.0, q);
+                const double r_a = 0.180625 - q_a*q_a;
+
+                vals_chunk[j] = q_a * qnorm_as241_num_1(r_a) / qnorm_as241_den_1(r_a);
+            }
+        }
+
+        if (n_tail == ullint_t(0)) {
+            continue;
+        }
+
+        const ullint_t n_tail_padded = (n_tail + STATS_BATCH_MATH_WIDTH - ullint_t(1)) / STATS_BATCH_MATH_WIDTH * STATS_BATCH_MATH_WIDTH;
+
+        for (ullint_t j=n_tail; j < n_tail_padded; ++j) {
+            tail_vals[j] = 0.5;
+        }
+
+        batch_log(tail_vals,n_tail_padded);
+
+        for (ullint_t j_1=ullint_t(0); j_1 < n_tail_padded; j_1 += STATS_BATCH_MATH_WIDTH)
+        {
+            double* __stats_pointer_settings__ tail_chunk = tail_vals + j_1;
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < STATS_BATCH_MATH_WIDTH; ++j)
+            {
+                // r = sqrt(-log(min(p, 1-p))), with -log(.) in [log(2), 709]. std::sqrt keeps an errno
+                // branch (and a library call) in the loop unless compiled with -fno-math-errno; instead,
+                // 1/sqrt(x) is refined from a bit-level estimate (error < 3.5%) by four Newton steps,
+                // and a final step on sqrt(x) itself leaves an error within an ulp
+
+                const double x = - tail_chunk[j];
+
+                double y = batch_bits_double(ullint_t(0x5FE6EB50C7B537A9) - (batch_double_bits(x) >> 1));
+
+                y = y*(1.5 - 0.5*x*y*y);
+                y = y*(1.5 - 0.5*x*y*y);
+                y = y*(1.5 - 0.5*x*y*y);
+                y = y*(1.5 - 0.5*x*y*y);
+
+                const double r_0 = x*y;
+                const double r = r_0 + 0.5*y*(x - r_0*r_0);
+
+                // R_2(r - 1.6) for r <= 5, and R_3(r - 5) beyond
+
+                const ullint_t far_mask = ullint_t(0) - ((batch_double_bits(r) + (ullint_t(0x8000000000000000) - batch_double_bits(split_2) - ullint_t(1))) >> 63);
+
+                const double r_b = batch_select(far_mask, split_2, r) - 1.6;
+                const double r_c = batch_select(far_mask, r, split_2) - 5.0;
+
+                tail_chunk[j] = batch_select(far_mask, qnorm_as241_num_3(r_c), qnorm_as241_num_2(r_b))
+                                / batch_select(far_mask, qnorm_as241_den_3(r_c), qnorm_as241_den_2(r_b));
+            }
+        }
+
+        for (ullint_t j=ullint_t(0); j < n_tail; ++j) {
+            vals_block[tail_ind[j]] = tail_sign[j] * tail_vals[j];
+        }
+    }
+}
+
+}
+
+#endif
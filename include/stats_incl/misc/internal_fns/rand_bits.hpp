@@ -0,0 +1,206 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * uniform random bits and unit-interval draws from a generic random engine
+ */
+
+#ifndef _statslib_rand_bits_HPP
+#define _statslib_rand_bits_HPP
+
+namespace internal
+{
+
+// 64 uniformly distributed random bits from any uniform random bit generator;
+// engines with a full 64-bit range are called once, otherwise the required
+// number of whole bits is collected from repeated (rejection-sampled) calls
+
+template<typename rngT>
+statslib_inline
+ullint_t
+rand_bits64(rngT& engine)
+{
+    const ullint_t eng_min = static_cast<ullint_t>(rngT::min());
+    const ullint_t eng_range = static_cast<ullint_t>(rngT::max()) - eng_min;
+
+    if (eng_range == ~ullint_t(0)) {
+        return static_cast<ullint_t>(engine()) - eng_min;
+    }
+
+    // number of whole bits per call: 2^n_bits <= eng_range + 1
+
+    const ullint_t eng_count = eng_range + ullint_t(1);
+
+    uint_t n_bits = 0;
+    while ((eng_count >> (n_bits + 1U)) != ullint_t(0)) {
+        ++n_bits;
+    }
+
+    const ullint_t accept_lim = (eng_count >> n_bits) << n_bits;
+    const ullint_t bits_mask = (ullint_t(1) << n_bits) - ullint_t(1);
+
+    ullint_t ret = 0;
+
+    for (uint_t n_collected = 0; n_collected < 64U; n_collected += n_bits)
+    {
+        ullint_t draw_val = static_cast<ullint_t>(engine()) - eng_min;
+
+        while (draw_val >= accept_lim) {
+            draw_val = static_cast<ullint_t>(engine()) - eng_min;
+        }
+
+        ret = (ret << n_bits) | (draw_val & bits_mask);
+    }
+
+    return ret;
+}
+
+// number of set bits in a 64-bit word
+
+statslib_inline
+uint_t
+popcount64(ullint_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint_t>(__builtin_popcountll(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return static_cast<uint_t>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// double-precision draw from [0,1) using the upper 53 bits
+
+template<typename rngT>
+statslib_inline
+double
+rand_unif53(rngT& engine)
+{
+    return static_cast<double>(rand_bits64(engine) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// draws from the open interval (0,1), (k + 1/2) / 2^m for an m-bit integer k, which fills the
+// significand exactly: doubles use m = 52 bits (a 53-bit significand), floats m = 23 bits
+// (a 24-bit significand), so neither end point can be produced by rounding
+
+template<typename rngT>
+statslib_inline
+double
+rand_unif53_open(rngT& engine)
+{
+    return (static_cast<double>(rand_bits64(engine) >> 12) + 0.5) * (1.0 / 4503599627370496.0);
+}
+
+template<typename rngT>
+statslib_inline
+float
+rand_unif24_open(rngT& engine)
+{
+    return (static_cast<float>(rand_bits64(engine) >> 41) + 0.5f) * (1.0f / 8388608.0f);
+}
+
+template<typename T, typename rngT>
+statslib_inline
+typename std::enable_if<std::is_same<T,float>::value, float>::type
+rand_unif_open(rngT& engine)
+{
+    return rand_unif24_open(engine);
+}
+
+template<typename T, typename rngT>
+statslib_inline
+typename std::enable_if<!std::is_same<T,float>::value, T>::type
+rand_unif_open(rngT& engine)
+{
+    return static_cast<T>(rand_unif53_open(engine));
+}
+
+// bulk draws from (0,1), stored as doubles: one engine word per draw, or, when the computation
+// type T is float, two 24-bit-significand draws per word
+
+template<typename T, typename rngT>
+statslib_inline
+typename std::enable_if<!std::is_same<T,float>::value>::type
+rand_unif_open_fill(rngT& engine, double* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = (static_cast<double>(rand_bits64(engine) >> 12) + 0.5) * (1.0 / 4503599627370496.0);
+    }
+}
+
+template<typename T, typename rngT>
+statslib_inline
+typename std::enable_if<std::is_same<T,float>::value>::type
+rand_unif_open_fill(rngT& engine, double* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    ullint_t j = ullint_t(0);
+
+    for (; j + ullint_t(1) < num_elem; j += ullint_t(2))
+    {
+        const ullint_t draw_bits = rand_bits64(engine);
+
+        vals_out[j]   = (static_cast<double>(draw_bits >> 41) + 0.5) * (1.0 / 8388608.0);
+        vals_out[j+1] = (static_cast<double>((draw_bits >> 9) & ullint_t(0x7FFFFF)) + 0.5) * (1.0 / 8388608.0);
+    }
+
+    if (j < num_elem) {
+        vals_out[j] = static_cast<double>(rand_unif24_open(engine));
+    }
+}
+
+// two-stage bulk fill for the inverse-transform samplers: a batch of (0,1) draws is generated,
+// then batch_fn(vals, n) maps the whole batch in place (typically through the kernels of
+// batch_math.hpp, which vectorize), and the results are written to vals_out. The batch passed
+// to batch_fn is padded with 1/2 to a multiple of STATS_BATCH_MATH_WIDTH, and the transform is
+// computed in double precision whatever the output type.
+
+template<typename T, typename rngT, typename rT, typename fnT>
+statslib_inline
+void
+rand_unif_batch_fill(rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem, const fnT& batch_fn)
+{
+    double batch_vals[STATS_RAND_UNIF_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+
+    for (ullint_t j=ullint_t(0); j < num_elem; j += ullint_t(STATS_RAND_UNIF_BATCH_SIZE))
+    {
+        const ullint_t n_batch = (num_elem - j < ullint_t(STATS_RAND_UNIF_BATCH_SIZE)) ? num_elem - j : ullint_t(STATS_RAND_UNIF_BATCH_SIZE);
+        const ullint_t n_padded = (n_batch + STATS_BATCH_MATH_WIDTH - ullint_t(1)) / STATS_BATCH_MATH_WIDTH * STATS_BATCH_MATH_WIDTH;
+
+        rand_unif_open_fill<T>(engine,batch_vals,n_batch);
+
+        for (ullint_t i=n_batch; i < n_padded; ++i) {
+            batch_vals[i] = 0.5;
+        }
+
+        batch_fn(batch_vals,n_padded);
+
+        for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+            vals_out[j + i] = static_cast<rT>(batch_vals[i]);
+        }
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,44 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * random engine substreams for the vector/matrix samplers
+ */
+
+#ifndef _statslib_rand_substream_HPP
+#define _statslib_rand_substream_HPP
+
+namespace internal
+{
+
+// build the engine for block 'stream_ind' of a seeded vector/matrix draw;
+// Philox substreams with the same key occupy disjoint counter ranges, so the
+// blocks are non-overlapping and depend only on (seed_val, stream_ind)
+
+statslib_inline
+philox4x64
+rand_substream_engine(const ullint_t seed_val, const ullint_t stream_ind)
+{
+    return philox4x64(seed_val,stream_ind);
+}
+
+}
+
+#endif
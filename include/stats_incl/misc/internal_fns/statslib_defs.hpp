@@ -73,45 +73,21 @@
 
 //
 
-#define RAND_DIST_FN_VEC(dist_name, vals_out, num_elem,                                 \
+#define RAND_DIST_FN_VEC(dist_name, vals_out, num_elem, seed_val,                       \
                          ...)                                                           \
 {                                                                                       \
-    ullint_t n_threads = omp_get_max_threads();                                         \
-    n_threads = std::min(n_threads,STATS_OMP_N_BLOCKS);                                 \
-                                                                                        \
-    ullint_t n_per_block = num_elem / n_threads;                                        \
-    ullint_t n_remainder = num_elem % n_threads;                                        \
+    const ullint_t n_blocks = (num_elem + STATS_RAND_BLOCK_SIZE - ullint_t(1))          \
+                                / STATS_RAND_BLOCK_SIZE;                                \
                                                                                         \
-    if (n_per_block > STATS_OMP_MIN_N_PER_BLOCK)                                        \
+    _Pragma("omp parallel for if(n_blocks > ullint_t(1))")                              \
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)                                     \
     {                                                                                   \
-        std::vector<rand_engine_t> engines;                                             \
-                                                                                        \
-        for (ullint_t k=ullint_t(0); k < n_threads; ++k)                                \
-        {                                                                               \
-            engines.push_back(rand_engine_t(std::random_device{}()));                   \
-        }                                                                               \
+        philox4x64 engine = internal::rand_substream_engine(seed_val,j);                \
                                                                                         \
-        _Pragma("omp parallel for")                                                     \
-        for (ullint_t j=ullint_t(0); j < n_threads; ++j)                                \
-        {                                                                               \
-            ullint_t block_dim = j*n_per_block;                                         \
-            for (ullint_t i=ullint_t(0); i < n_per_block; ++i)                          \
-            {                                                                           \
-                vals_out[i+block_dim] = dist_name(__VA_ARGS__,engines[j]);              \
-            }                                                                           \
-        }                                                                               \
+        const ullint_t begin_ind = j*STATS_RAND_BLOCK_SIZE;                             \
+        const ullint_t end_ind = std::min(begin_ind + STATS_RAND_BLOCK_SIZE, num_elem); \
                                                                                         \
-        if (n_remainder > ullint_t(0))                                                  \
-        {                                                                               \
-            ullint_t begin_ind = num_elem - n_remainder - ullint_t(1);                  \
-            for (ullint_t i=begin_ind; i < num_elem; ++i)                               \
-            {                                                                           \
-                vals_out[i] = dist_name(__VA_ARGS__,engines[0]);                        \
-            }                                                                           \
-        }                                                                               \
-    } else {                                                                            \
-        rand_engine_t engine(std::random_device{}());                                   \
-        for (ullint_t i=ullint_t(0); i < num_elem; ++i)                                 \
+        for (ullint_t i=begin_ind; i < end_ind; ++i)                                    \
         {                                                                               \
             vals_out[i] = dist_name(__VA_ARGS__,engine);                                \
         }                                                                               \
@@ -120,6 +96,26 @@
 
 //
 
+#define RAND_DIST_FN_VEC_FILL(fill_name, vals_out, num_elem, seed_val,                  \
+                              ...)                                                      \
+{                                                                                       \
+    const ullint_t n_blocks = (num_elem + STATS_RAND_BLOCK_SIZE - ullint_t(1))          \
+                                / STATS_RAND_BLOCK_SIZE;                                \
+                                                                                        \
+    _Pragma("omp parallel for if(n_blocks > ullint_t(1))")                              \
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)                                     \
+    {                                                                                   \
+        philox4x64 engine = internal::rand_substream_engine(seed_val,j);                \
+                                                                                        \
+        const ullint_t begin_ind = j*STATS_RAND_BLOCK_SIZE;                             \
+        const ullint_t end_ind = std::min(begin_ind + STATS_RAND_BLOCK_SIZE, num_elem); \
+                                                                                        \
+        fill_name(__VA_ARGS__,engine,vals_out + begin_ind,end_ind - begin_ind);         \
+    }                                                                                   \
+}                                                                                       \
+
+//
+
 #else
 
 #define EVAL_DIST_FN_VEC(dist_name, vals_in, vals_out, num_elem,                        \
@@ -131,19 +127,59 @@
     }                                                                                   \
 }                                                                                       \
 
-#define RAND_DIST_FN_VEC(dist_name, vals_out, num_elem,                                 \
+#define RAND_DIST_FN_VEC(dist_name, vals_out, num_elem, seed_val,                       \
                          ...)                                                           \
 {                                                                                       \
-    rand_engine_t engine(std::random_device{}());                                       \
-    for (ullint_t j=ullint_t(0); j < num_elem; ++j)                                     \
+    const ullint_t n_blocks = (num_elem + STATS_RAND_BLOCK_SIZE - ullint_t(1))          \
+                                / STATS_RAND_BLOCK_SIZE;                                \
+                                                                                        \
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)                                     \
     {                                                                                   \
-        vals_out[j] = dist_name(__VA_ARGS__,engine);                                    \
+        philox4x64 engine = internal::rand_substream_engine(seed_val,j);                \
+                                                                                        \
+        const ullint_t begin_ind = j*STATS_RAND_BLOCK_SIZE;                             \
+        const ullint_t end_ind = std::min(begin_ind + STATS_RAND_BLOCK_SIZE, num_elem); \
+                                                                                        \
+        for (ullint_t i=begin_ind; i < end_ind; ++i)                                    \
+        {                                                                               \
+            vals_out[i] = dist_name(__VA_ARGS__,engine);                                \
+        }                                                                               \
+    }                                                                                   \
+}                                                                                       \
+
+//
+
+#define RAND_DIST_FN_VEC_FILL(fill_name, vals_out, num_elem, seed_val,                  \
+                              ...)                                                      \
+{                                                                                       \
+    const ullint_t n_blocks = (num_elem + STATS_RAND_BLOCK_SIZE - ullint_t(1))          \
+                                / STATS_RAND_BLOCK_SIZE;                                \
+                                                                                        \
+    for (ullint_t j=ullint_t(0); j < n_blocks; ++j)                                     \
+    {                                                                                   \
+        philox4x64 engine = internal::rand_substream_engine(seed_val,j);                \
+                                                                                        \
+        const ullint_t begin_ind = j*STATS_RAND_BLOCK_SIZE;                             \
+        const ullint_t end_ind = std::min(begin_ind + STATS_RAND_BLOCK_SIZE, num_elem); \
+                                                                                        \
+        fill_name(__VA_ARGS__,engine,vals_out + begin_ind,end_ind - begin_ind);         \
     }                                                                                   \
 }                                                                                       \
 
 #endif
 
 
+// sequential fill from a user-supplied engine
+
+#define RAND_DIST_FN_VEC_ENGINE(dist_name, vals_out, num_elem, engine,                  \
+                                ...)                                                    \
+{                                                                                       \
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)                                     \
+    {                                                                                   \
+        vals_out[j] = dist_name(__VA_ARGS__,engine);                                    \
+    }                                                                                   \
+}                                                                                       \
+
 //
 // Vector/Matrix core code
 
@@ -230,8 +266,19 @@ define GEN_MAT_RAND_FN(dist_name_vec, ...)
 
 #define MAIN_MAT_RAND_DIST_FN(dist_name, ...)                                           \
 {                                                                                       \
-    X = blaze::map(X,[__VA_ARGS__](double x){ STATS_UNUSED_PAR(x);                      \
-                                              return dist_name(__VA_ARGS__);} );        \
+    const ullint_t n_rows_X = mat_ops::n_rows(X);                                       \
+    const ullint_t n_cols_X = mat_ops::n_cols(X);                                       \
+                                                                                        \
+    std::vector<typename mT::ElementType> vals_tmp(n_rows_X*n_cols_X);                  \
+    STATS_VEC_NAME(dist_name)(__VA_ARGS__, vals_tmp.data(), vals_tmp.size());           \
+                                                                                        \
+    for (ullint_t j=ullint_t(0); j < n_cols_X; ++j)                                     \
+    {                                                                                   \
+        for (ullint_t i=ullint_t(0); i < n_rows_X; ++i)                                 \
+        {                                                                               \
+            X(i,j) = vals_tmp[i + j*n_rows_X];                                          \
+        }                                                                               \
+    }                                                                                   \
 }
 
 #else
@@ -0,0 +1,91 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * math functions that dispatch on constant evaluation: gcem at compile time, <cmath> at run time
+ */
+
+#ifndef _statslib_stmath_HPP
+#define _statslib_stmath_HPP
+
+#ifdef STATS_USE_RUNTIME_MATH
+
+namespace stmath_dispatch
+{
+
+#define STATS_STMATH_UNARY_FN(fn_name)                                                              \
+template<typename T>                                                                                \
+constexpr                                                                                           \
+return_t<T>                                                                                         \
+fn_name(const T x)                                                                                  \
+noexcept                                                                                            \
+{                                                                                                   \
+    return( STATS_IS_CONSTANT_EVALUATED() ?                                                         \
+                static_cast<return_t<T>>(gcem::fn_name(x)) :                                        \
+                static_cast<return_t<T>>(std::fn_name(x)) );                                        \
+}
+
+STATS_STMATH_UNARY_FN(atan)
+STATS_STMATH_UNARY_FN(erf)
+STATS_STMATH_UNARY_FN(exp)
+STATS_STMATH_UNARY_FN(expm1)
+STATS_STMATH_UNARY_FN(lgamma)
+STATS_STMATH_UNARY_FN(log)
+STATS_STMATH_UNARY_FN(log1p)
+STATS_STMATH_UNARY_FN(sqrt)
+STATS_STMATH_UNARY_FN(tan)
+STATS_STMATH_UNARY_FN(tanh)
+
+#undef STATS_STMATH_UNARY_FN
+
+template<typename T>
+constexpr
+T
+abs(const T x)
+noexcept
+{
+    return( STATS_IS_CONSTANT_EVALUATED() ? gcem::abs(x) : std::abs(x) );
+}
+
+template<typename T1, typename T2>
+constexpr
+common_return_t<T1,T2>
+pow(const T1 base, const T2 exp_term)
+noexcept
+{
+    return( STATS_IS_CONSTANT_EVALUATED() ? \
+                static_cast<common_return_t<T1,T2>>(gcem::pow(base,exp_term)) :
+                static_cast<common_return_t<T1,T2>>(std::pow(base,exp_term)) );
+}
+
+template<typename T1, typename T2>
+constexpr
+common_t<T1,T2>
+max(const T1 x, const T2 y)
+noexcept
+{
+    return gcem::max(x,y);
+}
+
+}
+
+#endif
+
+#endif
@@ -40,6 +40,7 @@
 #include "norm.hpp"
 #include "pois.hpp"
 #include "t.hpp"
+#include "tnorm.hpp"
 #include "unif.hpp"
 #include "weibull.hpp"
 // #include "wish.hpp"
@@ -46,17 +46,60 @@
 
 #ifndef STATS_GO_INLINE
     #define statslib_constexpr constexpr
-    #define stmath gcem
 #else
     #define statslib_constexpr inline
-    #include <cmath>
     #define stmath std
 #endif
 
 // include some basic libraries
 
+#include <cmath>
+#include <cstring>
+#include <ios>
+#include <iterator>
 #include <limits>
 #include <random>
+#include <type_traits>
+#include <vector>
+
+// in constexpr mode, the math functions dispatch on constant evaluation: gcem when evaluated at
+// compile time, and <cmath> at run time (see internal_fns/stmath.hpp). Without a way to detect
+// constant evaluation (C++20 std::is_constant_evaluated, or the equivalent compiler builtin),
+// or with STATS_DONT_USE_RUNTIME_MATH defined, gcem is used in both cases.
+
+#ifndef STATS_IS_CONSTANT_EVALUATED
+    #if defined(__cpp_lib_is_constant_evaluated)
+        #define STATS_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+    #elif defined(__has_builtin)
+        #if __has_builtin(__builtin_is_constant_evaluated)
+            #define STATS_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+        #endif
+    #elif (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+        #define STATS_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#endif
+
+#if !defined(STATS_GO_INLINE) && !defined(stmath)
+    #if defined(STATS_IS_CONSTANT_EVALUATED) && !defined(STATS_DONT_USE_RUNTIME_MATH)
+        #define STATS_USE_RUNTIME_MATH
+        #define stmath stmath_dispatch
+    #else
+        #define stmath gcem
+    #endif
+#endif
+
+// the incomplete gamma and beta functions have runtime kernels (internal_fns/incomplete_gamma_kernel.hpp and
+// incomplete_beta_kernel.hpp), in double precision, which replace gcem wherever the math functions above use <cmath>
+
+#ifndef STATS_USE_RUNTIME_KERNEL
+    #if defined(STATS_GO_INLINE)
+        #define STATS_USE_RUNTIME_KERNEL(T) (sizeof(T) <= sizeof(double))
+    #elif defined(STATS_USE_RUNTIME_MATH)
+        #define STATS_USE_RUNTIME_KERNEL(T) (sizeof(T) <= sizeof(double) && !STATS_IS_CONSTANT_EVALUATED())
+    #else
+        #define STATS_USE_RUNTIME_KERNEL(T) false
+    #endif
+#endif
 
 // typedefs
 
@@ -82,6 +125,18 @@ namespace stats
 
     template<typename ...T>
     using common_return_t = return_t<common_t<T...>>;
+
+    // random engines: any UniformRandomBitGenerator (unsigned result_type)
+
+    template<typename T, typename = void>
+    struct is_rand_engine : std::false_type {};
+
+    template<typename T>
+    struct is_rand_engine<T,typename std::enable_if<std::is_unsigned<typename T::result_type>::value>::type>
+    : std::true_type {};
+
+    template<typename T>
+    using enable_if_engine = std::enable_if<is_rand_engine<T>::value>;
 }
 
 // enable OpenMP
@@ -94,11 +149,55 @@ namespace stats
     #define STATS_OMP_MIN_N_PER_BLOCK ullint_t(4)
 #endif
 
+// hint to vectorize the element-wise loops of the batch math kernels
+
+#ifndef STATS_SIMD_LOOP
+    #if defined(STATS_USE_OPENMP)
+        #define STATS_SIMD_LOOP _Pragma("omp simd")
+    #elif defined(__clang__)
+        #define STATS_SIMD_LOOP _Pragma("clang loop vectorize(enable)")
+    #elif defined(__GNUC__)
+        #define STATS_SIMD_LOOP _Pragma("GCC ivdep")
+    #else
+        #define STATS_SIMD_LOOP
+    #endif
+#endif
+
+// number of draws generated from each random substream by the vector/matrix samplers;
+// the partition does not depend on the number of threads, so results are reproducible
+
+#ifndef STATS_RAND_BLOCK_SIZE
+    #define STATS_RAND_BLOCK_SIZE ullint_t(4096)
+#endif
+
+// number of uniform draws generated per batch by the inverse-transform samplers
+
+#ifndef STATS_RAND_UNIF_BATCH_SIZE
+    #define STATS_RAND_UNIF_BATCH_SIZE 256
+#endif
+
+// number of inputs evaluated per batch by the vectorized density kernels; a multiple of STATS_BATCH_MATH_WIDTH
+
+#ifndef STATS_DENS_BATCH_SIZE
+    #define STATS_DENS_BATCH_SIZE 256
+#endif
+
+// number of draws buffered by stats::sampler; a block of doubles fits in L1 cache
+
+#ifndef STATS_SAMPLER_BLOCK_SIZE
+    #define STATS_SAMPLER_BLOCK_SIZE ullint_t(1024)
+#endif
+
+// number of rejection candidates generated per batch by the gamma batch sampler
+
+#ifndef STATS_RGAMMA_BATCH_SIZE
+    #define STATS_RGAMMA_BATCH_SIZE 256
+#endif
+
 // enable std::vector features
 
 #ifdef STATS_ENABLE_STDVEC_WRAPPERS
     #include <algorithm>
-    #include <vector>
 #endif
 
 // #ifndef STATS_ENABLE_STDVEC_WRAPPERS
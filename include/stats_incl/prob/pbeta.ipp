@@ -31,10 +31,14 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pbeta_compute(const T x, const T a_par, const T b_par)
+pbeta_compute(const T x, const T a_par, const T b_par, const bool log_form)
 noexcept
 {
-    return gcem::incomplete_beta(a_par,b_par,x);
+    return( STATS_USE_RUNTIME_KERNEL(T) ? \
+                static_cast<T>(ibeta_kernel(static_cast<double>(a_par),static_cast<double>(b_par),
+                                            static_cast<double>(x),1.0 - static_cast<double>(x),false,log_form)) :
+            //
+                log_if(gcem::incomplete_beta(a_par,b_par,x), log_form) );
 }
 
 template<typename T>
@@ -74,7 +78,7 @@ noexcept
             (a_par == T(0) || b_par == T(0) || GCINT::any_posinf(a_par,b_par)) ? \
                 log_if(pbeta_limit_vals(x,a_par,b_par),log_form) :
             //
-            log_if(pbeta_compute(x,a_par,b_par), log_form) );
+            pbeta_compute(x,a_par,b_par,log_form) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
@@ -125,7 +129,32 @@ void
 pbeta_vec(const eT* __stats_pointer_settings__ vals_in, const T1 a_par, const T2 b_par, const bool log_form, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pbeta,vals_in,vals_out,num_elem,a_par,b_par,log_form);
+    const double a_par_d = static_cast<double>(a_par);
+    const double b_par_d = static_cast<double>(b_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(beta_sanity_check(a_par_d,b_par_d) && GCINT::all_finite(a_par_d,b_par_d) && a_par_d > 0.0 && b_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(pbeta,vals_in,vals_out,num_elem,a_par,b_par,log_form);
+        return;
+    }
+
+    const ibeta_pars_t pars = ibeta_pars(a_par_d,b_par_d);
+
+    dens_batch_eval(vals_in,vals_out,num_elem,0.5,
+        [=](const double x) { return x > 0.0 && x < 1.0; },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            double y_vals[STATS_DENS_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                y_vals[j] = 1.0 - x_vals[j];
+            }
+
+            batch_ibeta(pars,x_vals,y_vals,vals,n_vals,false,log_form);
+        },
+        [=](const eT x) { return pbeta(x,a_par,b_par,log_form); });
 }
 #endif
 
@@ -39,6 +39,19 @@ noexcept
                 dbinom(count,n_trials_par,prob_par,false) + pbinom_compute(x,n_trials_par,prob_par,count+1) );
 }
 
+template<typename T>
+statslib_constexpr
+T
+pbinom_compute(const llint_t x, const llint_t n_trials_par, const T prob_par, const bool log_form)
+noexcept
+{   // for 0 <= x < n, P(X <= x) = I_{1-p}(n - x, x + 1)
+    return( STATS_USE_RUNTIME_KERNEL(T) ? \
+                static_cast<T>(ibeta_kernel(static_cast<double>(n_trials_par - x),static_cast<double>(x + 1),
+                                            1.0 - static_cast<double>(prob_par),static_cast<double>(prob_par),false,log_form)) :
+            //
+                log_if(pbinom_compute(x,n_trials_par,prob_par,llint_t(0)), log_form) );
+}
+
 template<typename T>
 statslib_constexpr
 T
@@ -56,7 +69,7 @@ noexcept
             n_trials_par == llint_t(1) ? \
                 pbern(x,prob_par,log_form) :
             //
-            log_if(pbinom_compute(x,n_trials_par,prob_par,llint_t(0)), log_form) );
+            pbinom_compute(x,n_trials_par,prob_par,log_form) );
 }
 
 }
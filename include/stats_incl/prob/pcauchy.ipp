@@ -34,7 +34,11 @@ T
 pcauchy_compute(const T z)
 noexcept
 {
-    return( T(0.5) + stmath::atan(z) / T(GCEM_PI) );
+    return( // lower tail: atan(z) = -pi/2 - atan(1/z), without the cancellation against 1/2
+            z < T(-1) ? \
+                - stmath::atan(T(1) / z) / T(GCEM_PI) :
+            //
+            T(0.5) + stmath::atan(z) / T(GCEM_PI) );
 }
 
 template<typename T>
@@ -31,10 +31,13 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pchisq_compute(const T x, const T dof_par)
+pchisq_compute(const T x, const T dof_par, const bool log_form)
 noexcept
 {
-    return gcem::incomplete_gamma(dof_par/T(2),x/T(2));
+    return( STATS_USE_RUNTIME_KERNEL(T) ? \
+                static_cast<T>(igamma_kernel(static_cast<double>(dof_par/T(2)),static_cast<double>(x/T(2)),false,log_form)) :
+            //
+                log_if(gcem::incomplete_gamma(dof_par/T(2),x/T(2)), log_form) );
 }
 
 template<typename T>
@@ -46,8 +49,8 @@ noexcept
     return( !chisq_sanity_check(x,dof_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            STLIM<T>::epsilon() > x ? \
-                log_zero_if<T>(log_form) : 
+            x <= T(0) ? \
+                log_zero_if<T>(log_form) :
             // now x > 0 cases
             dof_par == T(0) ? \
                 log_one_if<T>(log_form) :
@@ -57,7 +60,7 @@ noexcept
             GCINT::is_posinf(dof_par) ? \
                 log_zero_if<T>(log_form) :
             //
-            log_if(pchisq_compute(x,dof_par), log_form) );
+            pchisq_compute(x,dof_par,log_form) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -106,7 +109,29 @@ void
 pchisq_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool log_form, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pchisq,vals_in,vals_out,num_elem,dof_par,log_form);
+    const double dof_par_d = static_cast<double>(dof_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(chisq_sanity_check(dof_par_d) && GCINT::is_finite(dof_par_d) && dof_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(pchisq,vals_in,vals_out,num_elem,dof_par,log_form);
+        return;
+    }
+
+    const igamma_shape_t shape = igamma_shape(0.5*dof_par_d);
+
+    dens_batch_eval(vals_in,vals_out,num_elem,dof_par_d,
+        [=](const double x) { return x > 0.0 && GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = 0.5*x_vals[j];
+            }
+
+            batch_igamma(shape,vals,n_vals,false,log_form);
+        },
+        [=](const eT x) { return pchisq(x,dof_par,log_form); });
 }
 #endif
 
@@ -28,12 +28,26 @@
 namespace internal
 {
 
+statslib_inline
+double
+pf_compute_kernel(const double z, const double a_par, const double b_par, const bool log_form)
+{   // z/(1+z) and its complement 1/(1+z) are both formed without a subtraction, and through 1/z for
+    // z > 1 so that a large z does not overflow
+    const double z_inv = 1.0 / z;
+
+    return( z > 1.0 ? ibeta_kernel(a_par,b_par,1.0 / (1.0 + z_inv),z_inv / (1.0 + z_inv),false,log_form) :
+                      ibeta_kernel(a_par,b_par,z / (1.0 + z),1.0 / (1.0 + z),false,log_form) );
+}
+
 template<typename T>
 statslib_constexpr
 T
-pf_compute(const T x, const T a_par, const T b_par)
+pf_compute(const T x, const T a_par, const T b_par, const bool log_form)
 {
-    return gcem::incomplete_beta(a_par,b_par, x / (T(1) + x));
+    return( STATS_USE_RUNTIME_KERNEL(T) ? \
+                static_cast<T>(pf_compute_kernel(static_cast<double>(x),static_cast<double>(a_par),static_cast<double>(b_par),log_form)) :
+            //
+                log_if(gcem::incomplete_beta(a_par,b_par, x / (T(1) + x)), log_form) );
 }
 
 template<typename T>
@@ -64,13 +78,15 @@ pf_vals_check(const T x, const T df1_par, const T df2_par, const bool log_form)
     return( !f_sanity_check(x,df1_par,df2_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            STLIM<T>::epsilon() > x ? \
+            x <= T(0) ? \
                 log_zero_if<T>(log_form) :
             //
             GCINT::any_posinf(df1_par,df2_par) ? \
                 pf_limit_vals_dof(x,df1_par,df2_par,log_form) :
+            GCINT::is_posinf(x) ? \
+                log_one_if<T>(log_form) :
             //
-            log_if(pf_compute(df1_par*x/df2_par,df1_par/T(2),df2_par/T(2)), log_form) );
+            pf_compute(df1_par*x/df2_par,df1_par/T(2),df2_par/T(2),log_form) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
@@ -121,7 +137,38 @@ void
 pf_vec(const eT* __stats_pointer_settings__ vals_in, const T1 df1_par, const T2 df2_par, const bool log_form, 
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pf,vals_in,vals_out,num_elem,df1_par,df2_par,log_form);
+    const double df1_par_d = static_cast<double>(df1_par);
+    const double df2_par_d = static_cast<double>(df2_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(f_sanity_check(df1_par_d,df2_par_d) && GCINT::all_finite(df1_par_d,df2_par_d) && df1_par_d > 0.0 && df2_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(pf,vals_in,vals_out,num_elem,df1_par,df2_par,log_form);
+        return;
+    }
+
+    const ibeta_pars_t pars = ibeta_pars(0.5*df1_par_d,0.5*df2_par_d);
+    const double df_ratio = df1_par_d / df2_par_d;
+
+    dens_batch_eval(vals_in,vals_out,num_elem,1.0,
+        [=](const double x) { return x > 0.0 && GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            double x_b_vals[STATS_DENS_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+            double y_b_vals[STATS_DENS_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                const double z = df_ratio*x_vals[j];
+                const double z_inv = 1.0 / z;
+
+                x_b_vals[j] = z > 1.0 ? 1.0 / (1.0 + z_inv) : z / (1.0 + z);
+                y_b_vals[j] = z > 1.0 ? z_inv / (1.0 + z_inv) : 1.0 / (1.0 + z);
+            }
+
+            batch_ibeta(pars,x_b_vals,y_b_vals,vals,n_vals,false,log_form);
+        },
+        [=](const eT x) { return pf(x,df1_par,df2_par,log_form); });
 }
 #endif
 
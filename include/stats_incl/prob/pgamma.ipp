@@ -31,10 +31,13 @@ namespace internal
 template<typename T>
 statslib_constexpr
 T
-pgamma_compute(const T x, const T shape_par, const T scale_par)
+pgamma_compute(const T x, const T shape_par, const T scale_par, const bool log_form)
 noexcept
 {
-    return gcem::incomplete_gamma(shape_par,x/scale_par);
+    return( STATS_USE_RUNTIME_KERNEL(T) ? \
+                static_cast<T>(igamma_kernel(static_cast<double>(shape_par),static_cast<double>(x/scale_par),false,log_form)) :
+            //
+                log_if(gcem::incomplete_gamma(shape_par,x/scale_par), log_form) );
 }
 
 template<typename T>
@@ -70,13 +73,13 @@ noexcept
             GCINT::all_posinf(x,scale_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            STLIM<T>::epsilon() > x ? \
+            x <= T(0) ? \
                 log_zero_if<T>(log_form) :
             //
             GCINT::any_posinf(x,shape_par,scale_par) || shape_par == T(0) ? \
                 log_if(pgamma_limit_vals(x,shape_par,scale_par), log_form) :
             //
-            log_if(pgamma_compute(x,shape_par,scale_par), log_form) );
+            pgamma_compute(x,shape_par,scale_par,log_form) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
@@ -127,7 +130,31 @@ void
 pgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 scale_par, const bool log_form, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pgamma,vals_in,vals_out,num_elem,shape_par,scale_par,log_form);
+    const double shape_par_d = static_cast<double>(shape_par);
+    const double scale_par_d = static_cast<double>(scale_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(gamma_sanity_check(shape_par_d,scale_par_d) && GCINT::all_finite(shape_par_d,scale_par_d) && shape_par_d > 0.0 && scale_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(pgamma,vals_in,vals_out,num_elem,shape_par,scale_par,log_form);
+        return;
+    }
+
+    const igamma_shape_t shape = igamma_shape(shape_par_d);
+    const double inv_scale_par = 1.0 / scale_par_d;
+
+    dens_batch_eval(vals_in,vals_out,num_elem,scale_par_d,
+        [=](const double x) { return x > 0.0 && GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = x_vals[j]*inv_scale_par;
+            }
+
+            batch_igamma(shape,vals,n_vals,false,log_form);
+        },
+        [=](const eT x) { return pgamma(x,shape_par,scale_par,log_form); });
 }
 #endif
 
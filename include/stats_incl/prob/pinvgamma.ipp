@@ -34,7 +34,11 @@ T
 pinvgamma_compute(const T recip_inp, const T shape_par, const T recip_par, const bool log_form)
 noexcept
 {
-    return log_if(T(1) - pgamma(recip_inp,shape_par,recip_par), log_form);
+    return( // upper tail of the Gamma distribution function, computed directly
+            STATS_USE_RUNTIME_KERNEL(T) && GCINT::all_finite(recip_inp,shape_par,recip_par) && recip_inp > T(0) && shape_par > T(0) && recip_par > T(0) ? \
+                static_cast<T>(igamma_kernel(static_cast<double>(shape_par),static_cast<double>(recip_inp/recip_par),true,log_form)) :
+            //
+                log_if(T(1) - pgamma(recip_inp,shape_par,recip_par), log_form) );
 }
 
 template<typename T>
@@ -116,7 +120,30 @@ void
 pinvgamma_vec(const eT* __stats_pointer_settings__ vals_in, const T1 shape_par, const T2 rate_par, const bool log_form, 
                     rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pinvgamma,vals_in,vals_out,num_elem,shape_par,rate_par,log_form);
+    const double shape_par_d = static_cast<double>(shape_par);
+    const double rate_par_d = static_cast<double>(rate_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(invgamma_sanity_check(shape_par_d,rate_par_d) && GCINT::all_finite(shape_par_d,rate_par_d) && shape_par_d > 0.0 && rate_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(pinvgamma,vals_in,vals_out,num_elem,shape_par,rate_par,log_form);
+        return;
+    }
+
+    const igamma_shape_t shape = igamma_shape(shape_par_d);
+
+    dens_batch_eval(vals_in,vals_out,num_elem,rate_par_d,
+        [=](const double x) { return x > 0.0 && GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = rate_par_d / x_vals[j];
+            }
+
+            batch_igamma(shape,vals,n_vals,true,log_form);
+        },
+        [=](const eT x) { return pinvgamma(x,shape_par,rate_par,log_form); });
 }
 #endif
 
@@ -36,7 +36,7 @@ plnorm_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_f
     return( !lnorm_sanity_check(x,mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            STLIM<T>::epsilon() > x ? \
+            x <= T(0) ? \
                 log_zero_if<T>(log_form) :
             //
             pnorm(stmath::log(x),mu_par,sigma_par,log_form) );
@@ -90,7 +90,44 @@ void
 plnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
                  rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(plnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    const double mu_par_d = static_cast<double>(mu_par);
+    const double sigma_par_d = static_cast<double>(sigma_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(lnorm_sanity_check(mu_par_d,sigma_par_d) && GCINT::all_finite(mu_par_d,sigma_par_d) && sigma_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(plnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+        return;
+    }
+
+    const double inv_sigma_par = 1.0 / sigma_par_d;
+
+    // |log(x)| < 710 for positive, normal x; the standardized values must stay within |z| < 1e150
+
+    if (!((std::abs(mu_par_d) + 710.0)*inv_sigma_par < 1e150)) {
+        EVAL_DIST_FN_VEC(plnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+        return;
+    }
+
+    dens_batch_eval(vals_in,vals_out,num_elem,1.0,
+        [=](const double x) { return x >= STLIM<double>::min() && GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = x_vals[j];
+            }
+
+            batch_log(vals,n_vals);
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = (vals[j] - mu_par_d)*inv_sigma_par;
+            }
+
+            batch_pnorm(vals,n_vals,log_form);
+        },
+        [=](const eT x) { return plnorm(x,mu_par,sigma_par,log_form); });
 }
 #endif
 
@@ -33,7 +33,7 @@ statslib_constexpr
 T
 plogis_compute(const T z)
 {
-    return( T(0.5)*( T(1) + gcem::tanh(z) ) );
+    return( T(0.5)*( T(1) + stmath::tanh(z) ) );
 }
 
 template<typename T>
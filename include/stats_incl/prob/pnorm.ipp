@@ -28,12 +28,15 @@
 namespace internal
 {
 
+// Cody's rational approximations (internal_fns/pnorm_kernel.hpp) give the CDF, and its log, with
+// full relative accuracy in the lower tail
+
 template<typename T>
 statslib_constexpr
 T
-pnorm_compute(const T z)
+pnorm_compute(const T z, const bool log_form)
 {
-    return( T(0.5) * (T(1) + stmath::erf(z / GCEM_SQRT_2)) );
+    return pnorm_cody(z,log_form);
 }
 
 template<typename T>
@@ -79,7 +82,7 @@ pnorm_vals_check(const T x, const T mu_par, const T sigma_par, const bool log_fo
             GCINT::any_inf(x,mu_par,sigma_par) || sigma_par == T(0) ? \
                 log_if(pnorm_limit_vals(x,mu_par,sigma_par),log_form) :
             //
-            log_if(pnorm_compute((x-mu_par)/sigma_par), log_form) );
+            pnorm_compute((x-mu_par)/sigma_par, log_form) );
 }
 
 template<typename T1, typename T2, typename T3, typename TC = common_return_t<T1,T2,T3>>
@@ -130,7 +133,30 @@ void
 pnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, const bool log_form, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+    const double mu_par_d = static_cast<double>(mu_par);
+    const double sigma_par_d = static_cast<double>(sigma_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(norm_sanity_check(mu_par_d,sigma_par_d) && GCINT::all_finite(mu_par_d,sigma_par_d) && sigma_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(pnorm,vals_in,vals_out,num_elem,mu_par,sigma_par,log_form);
+        return;
+    }
+
+    const double inv_sigma_par = 1.0 / sigma_par_d;
+
+    dens_batch_eval(vals_in,vals_out,num_elem,mu_par_d,
+        [=](const double x) { return std::abs(x - mu_par_d)*inv_sigma_par < 1e150; },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = (x_vals[j] - mu_par_d)*inv_sigma_par;
+            }
+
+            batch_pnorm(vals,n_vals,log_form);
+        },
+        [=](const eT x) { return pnorm(x,mu_par,sigma_par,log_form); });
 }
 #endif
 
@@ -49,13 +49,15 @@ ppois_compute_recur(const llint_t x, const T rate_par, const llint_t r_count)
 template<typename T>
 statslib_constexpr
 T
-ppois_compute(const llint_t x, const T rate_par)
+ppois_compute(const llint_t x, const T rate_par, const bool log_form)
 {
     return( rate_par > T(10) ? \
-            // switch to incomplete gamma function
-                T(1) - gcem::incomplete_gamma(T(x+1),rate_par) :
+            // switch to the upper incomplete gamma function
+                STATS_USE_RUNTIME_KERNEL(T) ? \
+                    static_cast<T>(igamma_kernel(static_cast<double>(x+1),static_cast<double>(rate_par),true,log_form)) :
+                    log_if(T(1) - gcem::incomplete_gamma(T(x+1),rate_par), log_form) :
             // else
-                stmath::exp(-rate_par) * ppois_compute_recur(x,rate_par,0U) );
+                log_if(stmath::exp(-rate_par) * ppois_compute_recur(x,rate_par,0U), log_form) );
 }
 
 template<typename T>
@@ -72,7 +74,7 @@ ppois_vals_check(const llint_t x, const T rate_par, const bool log_form)
             GCINT::is_posinf(rate_par) ? \
                 log_zero_if<T>(log_form) :
             //
-            log_if(ppois_compute(x,rate_par), log_form) );
+            ppois_compute(x,rate_par,log_form) );
 }
 
 }
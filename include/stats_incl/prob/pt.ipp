@@ -55,17 +55,41 @@ pt_compute_main(const T x, const T r_par)
                             pt_compute_main_2(T(1) + (x/r_par)*x,r_par)) );
 }
 
+statslib_inline
+double
+pt_compute_kernel(const double x, const double r_par, const bool log_form)
+{   // 2 P(T > |x|) = I_w(r/2, 1/2), with w = r/(r + x^2) and 1 - w both formed from q = x^2/r
+    // or its reciprocal, whichever is at most one
+    const double abs_x = std::abs(x);
+    const bool large_x = abs_x*abs_x > r_par;
+    const double q = large_x ? (r_par / abs_x) / abs_x : (abs_x / r_par) * abs_x;
+
+    const double w = large_x ? q / (1.0 + q) : 1.0 / (1.0 + q);
+    const double w_c = large_x ? 1.0 / (1.0 + q) : q / (1.0 + q);
+
+    const double tail_val = ibeta_kernel(0.5*r_par,0.5,w,w_c,false,log_form);
+
+    if (x <= 0.0) {
+        return log_form ? tail_val - GCEM_LOG_2 : 0.5*tail_val;
+    }
+
+    return log_form ? std::log1p(- 0.5*std::exp(tail_val)) : 1.0 - 0.5*tail_val;
+}
+
 template<typename T>
 statslib_constexpr
 T
-pt_compute(const T x, const T r_par)
+pt_compute(const T x, const T r_par, const bool log_form)
 {
     return( r_par == T(1) ? \
-                pcauchy_compute(x) :
+                log_if(pcauchy_compute(x), log_form) :
             r_par == T(2) ? \
-                T(0.5) + x / (T(2) * stmath::sqrt(x*x + T(2)) ) :
+                log_if(T(0.5) + x / (T(2) * stmath::sqrt(x*x + T(2)) ), log_form) :
+            //
+            STATS_USE_RUNTIME_KERNEL(T) ? \
+                static_cast<T>(pt_compute_kernel(static_cast<double>(x),static_cast<double>(r_par),log_form)) :
             //
-            pt_compute_main(x,T(r_par)) );
+                log_if(pt_compute_main(x,T(r_par)), log_form) );
 }
 
 template<typename T>
@@ -84,7 +108,7 @@ pt_vals_check(const T x, const T dof_par, const bool log_form)
             GCINT::is_posinf(dof_par) ? \
                 pnorm(x,T(0),T(1),log_form) :
             //
-            log_if(pt_compute(x,dof_par), log_form) );
+            pt_compute(x,dof_par,log_form) );
 }
 
 template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
@@ -133,7 +157,47 @@ void
 pt_vec(const eT* __stats_pointer_settings__ vals_in, const T1 dof_par, const bool log_form, 
              rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(pt,vals_in,vals_out,num_elem,dof_par,log_form);
+    const double dof_par_d = static_cast<double>(dof_par);
+
+    // parameters on the boundary of the parameter space, and the closed forms for one and two
+    // degrees of freedom, are left to the scalar function
+
+    if (!(t_sanity_check(dof_par_d) && GCINT::is_finite(dof_par_d) && dof_par_d > 0.0) || dof_par_d == 1.0 || dof_par_d == 2.0) {
+        EVAL_DIST_FN_VEC(pt,vals_in,vals_out,num_elem,dof_par,log_form);
+        return;
+    }
+
+    const ibeta_pars_t pars = ibeta_pars(0.5*dof_par_d,0.5);
+
+    dens_batch_eval(vals_in,vals_out,num_elem,0.0,
+        [=](const double x) { return GCINT::is_finite(x); },
+        [=](const double* x_vals, double* vals, const ullint_t n_vals)
+        {
+            double w_vals[STATS_DENS_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+            double w_c_vals[STATS_DENS_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                const double abs_x = std::abs(x_vals[j]);
+                const bool large_x = abs_x*abs_x > dof_par_d;
+                const double q = large_x ? (dof_par_d / abs_x) / abs_x : (abs_x / dof_par_d) * abs_x;
+
+                w_vals[j] = large_x ? q / (1.0 + q) : 1.0 / (1.0 + q);
+                w_c_vals[j] = large_x ? 1.0 / (1.0 + q) : q / (1.0 + q);
+            }
+
+            batch_ibeta(pars,w_vals,w_c_vals,vals,n_vals,false,log_form);
+
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j)
+            {
+                if (x_vals[j] <= 0.0) {
+                    vals[j] = log_form ? vals[j] - GCEM_LOG_2 : 0.5*vals[j];
+                } else {
+                    vals[j] = log_form ? std::log1p(- 0.5*std::exp(vals[j])) : 1.0 - 0.5*vals[j];
+                }
+            }
+        },
+        [=](const eT x) { return pt(x,dof_par,log_form); });
 }
 #endif
 
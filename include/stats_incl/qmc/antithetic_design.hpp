@@ -0,0 +1,73 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Antithetic sampling design
+ */
+
+#ifndef _statslib_antithetic_design_HPP
+#define _statslib_antithetic_design_HPP
+
+/**
+ * @brief Antithetic sampling design
+ *
+ * Generates pairs of points in (0,1)^d: each even-numbered point \c u has independent uniform coordinates,
+ * and is followed by its reflection <tt>1 - u</tt>. For an estimand that is monotone in each coordinate,
+ * the two members of a pair are negatively correlated, which reduces the variance of the sample mean;
+ * sample sizes should be even.
+ *
+ * The design holds its own random engine, seeded from the engine passed to the constructor.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::antithetic_design anti_design(2,engine);
+ * stats::rqnorm<arma::mat>(1000,0.0,1.0,anti_design);
+ * \endcode
+ */
+
+class antithetic_design
+{
+    public:
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        antithetic_design(const ullint_t n_dim, rngT& engine);
+
+        ullint_t dim() const;
+        ullint_t index() const;
+
+        void next(double* vals_out);
+        void reset();
+
+    private:
+        ullint_t n_dim_ = 0;
+        ullint_t point_ind_ = 0;
+
+        ullint_t seed_val_ = 0;
+        xoshiro256pp engine_;
+
+        std::vector<double> pair_vals_;
+};
+
+//
+// include implementation files
+
+#include "antithetic_design.ipp"
+
+#endif
@@ -0,0 +1,99 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Antithetic sampling design
+ */
+
+/**
+ * @brief Antithetic sampling design
+ *
+ * @param n_dim the number of dimensions.
+ * @param engine a random engine, passed by reference, used to seed the design.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+antithetic_design::antithetic_design(const ullint_t n_dim, rngT& engine)
+: n_dim_(n_dim), seed_val_(internal::rand_bits64(engine)), pair_vals_(n_dim)
+{
+    reset();
+}
+
+statslib_inline
+ullint_t
+antithetic_design::dim()
+const
+{
+    return n_dim_;
+}
+
+/**
+ * @brief The number of points generated since construction or the last call to \c reset
+ */
+
+statslib_inline
+ullint_t
+antithetic_design::index()
+const
+{
+    return point_ind_;
+}
+
+/**
+ * @brief Generate the next point of the design
+ *
+ * @param vals_out a pointer to \c dim() values, which are overwritten.
+ */
+
+statslib_inline
+void
+antithetic_design::next(double* vals_out)
+{
+    // the open-interval draws are symmetric about 1/2, so 1 - u is exact and also in (0,1)
+
+    if (point_ind_ % ullint_t(2) == ullint_t(0))
+    {
+        for (ullint_t j = 0; j < n_dim_; ++j) {
+            pair_vals_[j] = internal::rand_unif53_open(engine_);
+            vals_out[j] = pair_vals_[j];
+        }
+    }
+    else
+    {
+        for (ullint_t j = 0; j < n_dim_; ++j) {
+            vals_out[j] = 1.0 - pair_vals_[j];
+        }
+    }
+
+    ++point_ind_;
+}
+
+/**
+ * @brief Restart the design; the same points are generated again
+ */
+
+statslib_inline
+void
+antithetic_design::reset()
+{
+    engine_.seed(seed_val_);
+    point_ind_ = 0;
+}
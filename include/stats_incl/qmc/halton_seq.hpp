@@ -0,0 +1,98 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Halton low-discrepancy sequence
+ */
+
+#ifndef _statslib_halton_seq_HPP
+#define _statslib_halton_seq_HPP
+
+/**
+ * @brief Halton low-discrepancy sequence
+ *
+ * Coordinate \c j of point \c i is the radical inverse of \c i in base \c p_j, the <tt>j</tt>-th prime (Halton, 1960).
+ * The digits of each index are truncated to the largest number \c n_j with <tt>p_j^n_j <= 2^52</tt>, so that every
+ * point lies at the center of a cell of width <tt>p_j^(-n_j)</tt> in the open interval (0,1).
+ *
+ * The sequence is either deterministic, in which case the initial point (the origin) is skipped, or randomized
+ * with a random linear scramble of the digits: digit \c k of each coordinate is mapped to <tt>(h_k d_k + g_k) mod p_j</tt>,
+ * with <tt>h_k</tt> drawn uniformly from <tt>{1, ..., p_j - 1}</tt> and <tt>g_k</tt> from <tt>{0, ..., p_j - 1}</tt> (Matousek, 1998),
+ * which makes every point uniformly distributed; in the latter case the sequence starts at the origin.
+ *
+ * Halton sequences are best suited to a moderate number of dimensions; the Sobol sequence
+ * (\c stats::sobol_seq) usually has better projections in higher dimensions.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::halton_seq halton_gen(3,engine); // scrambled
+ *
+ * std::vector<double> point(3);
+ * halton_gen.next(point.data());
+ * \endcode
+ */
+
+class halton_seq
+{
+    public:
+        explicit halton_seq(const ullint_t n_dim);
+
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        halton_seq(const ullint_t n_dim, rngT& engine);
+
+        ullint_t dim() const;
+        ullint_t index() const;
+        bool scrambled() const;
+
+        void next(double* vals_out);
+
+        void discard(const ullint_t n_skip);
+        void reset();
+
+    private:
+        ullint_t n_dim_ = 0;
+        bool scrambled_ = false;
+        ullint_t point_ind_ = 0;
+
+        std::vector<ullint_t> bases_;
+        std::vector<ullint_t> n_digits_;
+        std::vector<ullint_t> digit_offsets_;
+        std::vector<double> cell_counts_;
+
+        // stored by dimension and digit
+
+        std::vector<ullint_t> digit_weights_;
+        std::vector<ullint_t> digit_mults_;
+        std::vector<ullint_t> digit_shifts_;
+        std::vector<ullint_t> zero_tails_;
+
+        void init_bases();
+
+        template<typename rngT>
+        void scramble(rngT& engine);
+};
+
+//
+// include implementation files
+
+#include "halton_seq.ipp"
+
+#endif
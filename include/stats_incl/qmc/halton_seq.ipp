@@ -0,0 +1,242 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Halton low-discrepancy sequence
+ */
+
+/**
+ * @brief Deterministic Halton sequence
+ *
+ * @param n_dim the number of dimensions.
+ *
+ * The sequence starts at its second point, as the first is the origin.
+ */
+
+statslib_inline
+halton_seq::halton_seq(const ullint_t n_dim)
+: n_dim_(n_dim), scrambled_(false)
+{
+    init_bases();
+    reset();
+}
+
+/**
+ * @brief Scrambled Halton sequence
+ *
+ * @param n_dim the number of dimensions.
+ * @param engine a random engine, passed by reference, used to draw the digit scrambles.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+halton_seq::halton_seq(const ullint_t n_dim, rngT& engine)
+: n_dim_(n_dim), scrambled_(true)
+{
+    init_bases();
+    scramble(engine);
+    reset();
+}
+
+statslib_inline
+ullint_t
+halton_seq::dim()
+const
+{
+    return n_dim_;
+}
+
+/**
+ * @brief The number of points generated (or discarded) since construction or the last call to \c reset
+ */
+
+statslib_inline
+ullint_t
+halton_seq::index()
+const
+{
+    return scrambled_ ? point_ind_ : point_ind_ - ullint_t(1);
+}
+
+statslib_inline
+bool
+halton_seq::scrambled()
+const
+{
+    return scrambled_;
+}
+
+/**
+ * @brief Generate the next point of the sequence
+ *
+ * @param vals_out a pointer to \c dim() values, which are overwritten.
+ */
+
+statslib_inline
+void
+halton_seq::next(double* vals_out)
+{
+    for (ullint_t j = 0; j < n_dim_; ++j)
+    {
+        const ullint_t base_j = bases_[j];
+        const ullint_t n_digits_j = n_digits_[j];
+        const ullint_t offset_j = digit_offsets_[j];
+
+        ullint_t digit_sum = 0;
+        ullint_t ind = point_ind_;
+        ullint_t k = 0;
+
+        for (; ind > ullint_t(0) && k < n_digits_j; ++k)
+        {
+            const ullint_t ind_quot = ind / base_j;
+            ullint_t digit_k = ind - ind_quot*base_j;
+            ind = ind_quot;
+
+            if (scrambled_) {
+                digit_k = (digit_mults_[offset_j + k]*digit_k + digit_shifts_[offset_j + k]) % base_j;
+            }
+
+            digit_sum += digit_k * digit_weights_[offset_j + k];
+        }
+
+        // the remaining (zero) digits of a scrambled sequence map to a fixed value
+
+        if (scrambled_ && k < n_digits_j) {
+            digit_sum += zero_tails_[offset_j + k];
+        }
+
+        vals_out[j] = (static_cast<double>(digit_sum) + 0.5) / cell_counts_[j];
+    }
+
+    ++point_ind_;
+}
+
+/**
+ * @brief Skip the next \c n_skip points of the sequence
+ */
+
+statslib_inline
+void
+halton_seq::discard(const ullint_t n_skip)
+{
+    point_ind_ += n_skip;
+}
+
+/**
+ * @brief Restart the sequence from its first point
+ */
+
+statslib_inline
+void
+halton_seq::reset()
+{
+    point_ind_ = scrambled_ ? ullint_t(0) : ullint_t(1);
+}
+
+statslib_inline
+void
+halton_seq::init_bases()
+{
+    const ullint_t max_cells = ullint_t(1) << 52;
+
+    bases_.clear();
+    n_digits_.clear();
+    digit_offsets_.clear();
+    cell_counts_.clear();
+    digit_weights_.clear();
+
+    // the first n_dim primes, by trial division
+
+    for (ullint_t cand = 2; bases_.size() < n_dim_; ++cand)
+    {
+        bool is_prime = true;
+
+        for (ullint_t i = 0; i < bases_.size() && bases_[i]*bases_[i] <= cand; ++i)
+        {
+            if (cand % bases_[i] == ullint_t(0)) {
+                is_prime = false;
+                break;
+            }
+        }
+
+        if (is_prime) {
+            bases_.push_back(cand);
+        }
+    }
+
+    for (ullint_t j = 0; j < n_dim_; ++j)
+    {
+        const ullint_t base_j = bases_[j];
+
+        ullint_t n_digits_j = 0;
+        ullint_t cell_count = 1;
+
+        while (cell_count <= max_cells / base_j) {
+            cell_count *= base_j;
+            ++n_digits_j;
+        }
+
+        n_digits_.push_back(n_digits_j);
+        digit_offsets_.push_back(digit_weights_.size());
+        cell_counts_.push_back(static_cast<double>(cell_count));
+
+        // digit k (least significant first) has weight base^(n_digits - k - 1)
+
+        for (ullint_t k = 0; k < n_digits_j; ++k) {
+            cell_count /= base_j;
+            digit_weights_.push_back(cell_count);
+        }
+    }
+}
+
+template<typename rngT>
+statslib_inline
+void
+halton_seq::scramble(rngT& engine)
+{
+    const ullint_t n_digits_total = digit_weights_.size();
+
+    digit_mults_.resize(n_digits_total);
+    digit_shifts_.resize(n_digits_total);
+    zero_tails_.resize(n_digits_total);
+
+    for (ullint_t j = 0; j < n_dim_; ++j)
+    {
+        const ullint_t base_j = bases_[j];
+        const ullint_t offset_j = digit_offsets_[j];
+
+        for (ullint_t k = 0; k < n_digits_[j]; ++k)
+        {
+            const ullint_t mult_k = 1U + static_cast<ullint_t>(internal::rand_unif53(engine) * static_cast<double>(base_j - 1U));
+            const ullint_t shift_k = static_cast<ullint_t>(internal::rand_unif53(engine) * static_cast<double>(base_j));
+
+            digit_mults_[offset_j + k] = std::min(mult_k, base_j - 1U);
+            digit_shifts_[offset_j + k] = std::min(shift_k, base_j - 1U);
+        }
+
+        ullint_t tail_sum = 0;
+
+        for (ullint_t k = n_digits_[j]; k > ullint_t(0); --k)
+        {
+            tail_sum += digit_shifts_[offset_j + k - 1U] * digit_weights_[offset_j + k - 1U];
+            zero_tails_[offset_j + k - 1U] = tail_sum;
+        }
+    }
+}
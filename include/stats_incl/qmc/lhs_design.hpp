@@ -0,0 +1,77 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Latin hypercube sampling design
+ */
+
+#ifndef _statslib_lhs_design_HPP
+#define _statslib_lhs_design_HPP
+
+/**
+ * @brief Latin hypercube sampling design
+ *
+ * Each block of \c n_points consecutive points forms a Latin hypercube sample (McKay, Beckman, and Conover, 1979):
+ * every axis of (0,1)^d is divided into \c n_points intervals, and each interval contains the coordinate of exactly
+ * one point, with the intervals matched across axes by independent random permutations. This stratifies every
+ * one-dimensional margin, which removes the additive (main effect) component of the variance of the sample mean.
+ *
+ * Subsequent blocks are independent Latin hypercube samples. The design holds its own random engine,
+ * seeded from the engine passed to the constructor. If \c n_points is zero, the generated points are NaN.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::lhs_design lhs(1000,3,engine);
+ * stats::rqnorm<arma::mat>(1000,0.0,1.0,lhs);
+ * \endcode
+ */
+
+class lhs_design
+{
+    public:
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        lhs_design(const ullint_t n_points, const ullint_t n_dim, rngT& engine);
+
+        ullint_t dim() const;
+        ullint_t index() const;
+
+        void next(double* vals_out);
+        void reset();
+
+    private:
+        ullint_t n_points_ = 0;
+        ullint_t n_dim_ = 0;
+        ullint_t point_ind_ = 0;
+
+        ullint_t seed_val_ = 0;
+        xoshiro256pp engine_;
+
+        std::vector<ullint_t> perm_inds_; // n_points x n_dim, stored by dimension
+
+        void draw_perms();
+};
+
+//
+// include implementation files
+
+#include "lhs_design.ipp"
+
+#endif
@@ -0,0 +1,137 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Latin hypercube sampling design
+ */
+
+/**
+ * @brief Latin hypercube sampling design
+ *
+ * @param n_points the number of points in each Latin hypercube block.
+ * @param n_dim the number of dimensions.
+ * @param engine a random engine, passed by reference, used to seed the design.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+lhs_design::lhs_design(const ullint_t n_points, const ullint_t n_dim, rngT& engine)
+: n_points_(n_points), n_dim_(n_dim), seed_val_(internal::rand_bits64(engine))
+{
+    reset();
+}
+
+statslib_inline
+ullint_t
+lhs_design::dim()
+const
+{
+    return n_dim_;
+}
+
+/**
+ * @brief The number of points generated since construction or the last call to \c reset
+ */
+
+statslib_inline
+ullint_t
+lhs_design::index()
+const
+{
+    return point_ind_;
+}
+
+/**
+ * @brief Generate the next point of the design
+ *
+ * @param vals_out a pointer to \c dim() values, which are overwritten.
+ */
+
+statslib_inline
+void
+lhs_design::next(double* vals_out)
+{
+    if (n_points_ == ullint_t(0))
+    {
+        for (ullint_t j = 0; j < n_dim_; ++j) {
+            vals_out[j] = STLIM<double>::quiet_NaN();
+        }
+
+        return;
+    }
+
+    const ullint_t block_ind = point_ind_ % n_points_;
+
+    if (block_ind == ullint_t(0) && point_ind_ > ullint_t(0)) {
+        draw_perms();
+    }
+
+    const double unif_max = 1.0 - STLIM<double>::epsilon() / 2.0;
+    const double n_points_d = static_cast<double>(n_points_);
+
+    for (ullint_t j = 0; j < n_dim_; ++j)
+    {
+        const double u_j = (static_cast<double>(perm_inds_[j*n_points_ + block_ind]) + internal::rand_unif53_open(engine_)) / n_points_d;
+
+        vals_out[j] = std::min(u_j, unif_max);
+    }
+
+    ++point_ind_;
+}
+
+/**
+ * @brief Restart the design; the same points are generated again
+ */
+
+statslib_inline
+void
+lhs_design::reset()
+{
+    engine_.seed(seed_val_);
+    point_ind_ = 0;
+
+    draw_perms();
+}
+
+// an independent random permutation of the intervals for each dimension (Fisher-Yates)
+
+statslib_inline
+void
+lhs_design::draw_perms()
+{
+    perm_inds_.resize(n_points_*n_dim_);
+
+    for (ullint_t j = 0; j < n_dim_; ++j)
+    {
+        ullint_t* perm_j = perm_inds_.data() + j*n_points_;
+
+        for (ullint_t i = 0; i < n_points_; ++i) {
+            perm_j[i] = i;
+        }
+
+        for (ullint_t i = n_points_; i > ullint_t(1); --i)
+        {
+            ullint_t swap_ind = static_cast<ullint_t>(internal::rand_unif53(engine_) * static_cast<double>(i));
+            swap_ind = (swap_ind < i) ? swap_ind : i - 1U;
+
+            std::swap(perm_j[i-1], perm_j[swap_ind]);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Quasi-Monte Carlo sequences, sampling designs, and sampling
+ */
+
+#ifndef _statslib_qmc_HPP
+#define _statslib_qmc_HPP
+
+#include "sobol_seq.hpp"
+#include "halton_seq.hpp"
+
+#include "antithetic_design.hpp"
+#include "lhs_design.hpp"
+#include "stratified_design.hpp"
+
+// point sequences in (0,1)^d accepted by the rq* samplers: low-discrepancy sequences and sampling designs
+
+template<typename T>
+struct is_qmc_seq : std::false_type {};
+
+template<>
+struct is_qmc_seq<sobol_seq> : std::true_type {};
+
+template<>
+struct is_qmc_seq<halton_seq> : std::true_type {};
+
+template<>
+struct is_qmc_seq<antithetic_design> : std::true_type {};
+
+template<>
+struct is_qmc_seq<stratified_design> : std::true_type {};
+
+template<>
+struct is_qmc_seq<lhs_design> : std::true_type {};
+
+template<typename T>
+using enable_if_qmc = std::enable_if<is_qmc_seq<T>::value>;
+
+#include "rqmc.hpp"
+
+#endif
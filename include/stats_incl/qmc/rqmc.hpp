@@ -0,0 +1,217 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Quasi-Monte Carlo sampling through the quantile functions
+ */
+
+#ifndef _statslib_rqmc_HPP
+#define _statslib_rqmc_HPP
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// generic: any quantile function
+
+template<typename mT, typename fnT, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqmc(const ullint_t n, const fnT& quant_fn, qmcT& qmc_gen);
+
+template<typename mT, typename fnT>
+statslib_inline
+mT
+rqmc(const ullint_t n, const ullint_t k, const fnT& quant_fn);
+
+// Uniform
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqunif(const ullint_t n, const T1 a_par, const T2 b_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1 = double, typename T2 = double>
+statslib_inline
+mT
+rqunif(const ullint_t n, const ullint_t k, const T1 a_par = T1(0), const T2 b_par = T2(1));
+
+// Normal
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqnorm(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1 = double, typename T2 = double>
+statslib_inline
+mT
+rqnorm(const ullint_t n, const ullint_t k, const T1 mu_par = T1(0), const T2 sigma_par = T2(1));
+
+// Log-Normal
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqlnorm(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1 = double, typename T2 = double>
+statslib_inline
+mT
+rqlnorm(const ullint_t n, const ullint_t k, const T1 mu_par = T1(0), const T2 sigma_par = T2(1));
+
+// Exponential
+
+template<typename mT, typename T1, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqexp(const ullint_t n, const T1 rate_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1 = double>
+statslib_inline
+mT
+rqexp(const ullint_t n, const ullint_t k, const T1 rate_par = T1(1));
+
+// Gamma
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqgamma(const ullint_t n, const T1 shape_par, const T2 scale_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par);
+
+// Inverse-Gamma
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqinvgamma(const ullint_t n, const T1 shape_par, const T2 rate_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par);
+
+// Beta
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqbeta(const ullint_t n, const T1 a_par, const T2 b_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par);
+
+// Chi-squared
+
+template<typename mT, typename T1, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqchisq(const ullint_t n, const T1 dof_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1>
+statslib_inline
+mT
+rqchisq(const ullint_t n, const ullint_t k, const T1 dof_par);
+
+// Student's t
+
+template<typename mT, typename T1, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqt(const ullint_t n, const T1 dof_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1>
+statslib_inline
+mT
+rqt(const ullint_t n, const ullint_t k, const T1 dof_par);
+
+// F
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqf(const ullint_t n, const T1 df1_par, const T2 df2_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par);
+
+// Cauchy
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqcauchy(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par);
+
+// Laplace
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqlaplace(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqlaplace(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par);
+
+// Logistic
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqlogis(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par);
+
+// Weibull
+
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type* = nullptr>
+statslib_inline
+mT
+rqweibull(const ullint_t n, const T1 shape_par, const T2 scale_par, qmcT& qmc_gen);
+
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par);
+
+#endif
+
+//
+// include implementation files
+
+#include "rqmc.ipp"
+
+#endif
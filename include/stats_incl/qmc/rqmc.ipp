@@ -0,0 +1,901 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Quasi-Monte Carlo sampling through the quantile functions
+ */
+
+//
+// generic
+
+namespace internal
+{
+
+template<typename fnT>
+statslib_inline
+double
+rqmc_quant_eval(const double p, const fnT& quant_fn)
+{
+    return static_cast<double>(quant_fn(p));
+}
+
+template<typename fnT, typename qmcT, typename rT>
+statslib_inline
+void
+rqmc_vec(const fnT& quant_fn, qmcT& qmc_gen, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const ullint_t n_dim = qmc_gen.dim();
+
+    if (n_dim == ullint_t(0)) {
+        return;
+    }
+
+    // the points are generated sequentially, one per row, and stored in column-major order;
+    // the quantile function is then applied element-wise (in parallel, if OpenMP is enabled)
+
+    const ullint_t n_points = num_elem / n_dim;
+
+    std::vector<double> point_vals(n_dim);
+    std::vector<double> unif_vals(n_points*n_dim);
+
+    for (ullint_t i=ullint_t(0); i < n_points; ++i)
+    {
+        qmc_gen.next(point_vals.data());
+
+        for (ullint_t j=ullint_t(0); j < n_dim; ++j) {
+            unif_vals[i + j*n_points] = point_vals[j];
+        }
+    }
+
+    const ullint_t n_unif = unif_vals.size();
+    const double* vals_in = unif_vals.data();
+
+    EVAL_DIST_FN_VEC(rqmc_quant_eval,vals_in,vals_out,n_unif,quant_fn);
+}
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename fnT, typename qmcT>
+statslib_inline
+void
+rqmc_mat_check(std::vector<eT>& X, const fnT& quant_fn, qmcT& qmc_gen)
+{
+    STDVEC_RAND_DIST_FN(rqmc,quant_fn,qmc_gen);
+}
+#endif
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+template<typename mT, typename fnT, typename qmcT>
+statslib_inline
+void
+rqmc_mat_check(mT& X, const fnT& quant_fn, qmcT& qmc_gen)
+{
+    MAIN_MAT_RAND_DIST_FN(rqmc,quant_fn,qmc_gen);
+}
+#endif
+
+}
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for any distribution with a quantile function
+ *
+ * @param n the number of output rows (points).
+ * @param quant_fn a quantile function, callable with a probability in (0,1) and returning a real value.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix, where \c d is the dimension of \c qmc_gen; row \c i is the quantile function
+ * applied to the next point of the sequence, so the columns are marginally distributed as the target distribution
+ * and the rows are evenly spread over its \c d-dimensional product.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(2,engine);
+ * stats::rqmc<arma::mat>(1024,[](double p){ return stats::qpois(p,3.0); },sobol_gen);
+ * \endcode
+ *
+ * @note The sequence is advanced by \c n points. \c std::vector outputs hold the matrix in column-major order.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename fnT, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqmc(const ullint_t n, const fnT& quant_fn, qmcT& qmc_gen)
+{
+    const ullint_t k = qmc_gen.dim();
+
+    GEN_MAT_RAND_FN(rqmc_mat_check,quant_fn,qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for any distribution with a quantile function
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param quant_fn a quantile function, callable with a probability in (0,1) and returning a real value.
+ *
+ * @return an \c n-by-\c k matrix of draws from a scrambled Sobol sequence, with scrambling drawn from the
+ * default engine of the calling thread (see \c stats::set_seed).
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename fnT>
+statslib_inline
+mT
+rqmc(const ullint_t n, const ullint_t k, const fnT& quant_fn)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqmc<mT>(n,quant_fn,qmc_gen);
+}
+#endif
+
+//
+// Uniform
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Uniform distribution
+ *
+ * @param n the number of output rows (points).
+ * @param a_par the lower bound parameter, a real-valued input.
+ * @param b_par the upper bound parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qunif.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqunif<arma::mat>(1024,1.0,3.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqunif(const ullint_t n, const T1 a_par, const T2 b_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[a_par,b_par](const double p){ return qunif(p,a_par,b_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Uniform distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param a_par the lower bound parameter, a real-valued input.
+ * @param b_par the upper bound parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqunif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqunif<mT>(n,a_par,b_par,qmc_gen);
+}
+#endif
+
+//
+// Normal
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Normal distribution
+ *
+ * @param n the number of output rows (points).
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qnorm.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqnorm<arma::mat>(1024,1.0,2.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqnorm(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[mu_par,sigma_par](const double p){ return qnorm(p,mu_par,sigma_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Normal distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqnorm<mT>(n,mu_par,sigma_par,qmc_gen);
+}
+#endif
+
+//
+// Log-Normal
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Log-Normal distribution
+ *
+ * @param n the number of output rows (points).
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qlnorm.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqlnorm<arma::mat>(1024,1.0,2.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqlnorm(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[mu_par,sigma_par](const double p){ return qlnorm(p,mu_par,sigma_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Log-Normal distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqlnorm<mT>(n,mu_par,sigma_par,qmc_gen);
+}
+#endif
+
+//
+// Exponential
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Exponential distribution
+ *
+ * @param n the number of output rows (points).
+ * @param rate_par the rate parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qexp.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqexp<arma::mat>(1024,2.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqexp(const ullint_t n, const T1 rate_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[rate_par](const double p){ return qexp(p,rate_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Exponential distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param rate_par the rate parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1>
+statslib_inline
+mT
+rqexp(const ullint_t n, const ullint_t k, const T1 rate_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqexp<mT>(n,rate_par,qmc_gen);
+}
+#endif
+
+//
+// Gamma
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Gamma distribution
+ *
+ * @param n the number of output rows (points).
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qgamma.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqgamma<arma::mat>(1024,2.0,3.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqgamma(const ullint_t n, const T1 shape_par, const T2 scale_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[shape_par,scale_par](const double p){ return qgamma(p,shape_par,scale_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Gamma distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqgamma<mT>(n,shape_par,scale_par,qmc_gen);
+}
+#endif
+
+//
+// Inverse-Gamma
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Inverse-Gamma distribution
+ *
+ * @param n the number of output rows (points).
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param rate_par the rate parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qinvgamma.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqinvgamma<arma::mat>(1024,2.0,3.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqinvgamma(const ullint_t n, const T1 shape_par, const T2 rate_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[shape_par,rate_par](const double p){ return qinvgamma(p,shape_par,rate_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Inverse-Gamma distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param rate_par the rate parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqinvgamma<mT>(n,shape_par,rate_par,qmc_gen);
+}
+#endif
+
+//
+// Beta
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Beta distribution
+ *
+ * @param n the number of output rows (points).
+ * @param a_par a real-valued shape parameter.
+ * @param b_par a real-valued shape parameter.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qbeta.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqbeta<arma::mat>(1024,2.0,3.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqbeta(const ullint_t n, const T1 a_par, const T2 b_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[a_par,b_par](const double p){ return qbeta(p,a_par,b_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Beta distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param a_par a real-valued shape parameter.
+ * @param b_par a real-valued shape parameter.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqbeta<mT>(n,a_par,b_par,qmc_gen);
+}
+#endif
+
+//
+// Chi-squared
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Chi-squared distribution
+ *
+ * @param n the number of output rows (points).
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qchisq.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqchisq<arma::mat>(1024,5.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqchisq(const ullint_t n, const T1 dof_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[dof_par](const double p){ return qchisq(p,dof_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Chi-squared distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1>
+statslib_inline
+mT
+rqchisq(const ullint_t n, const ullint_t k, const T1 dof_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqchisq<mT>(n,dof_par,qmc_gen);
+}
+#endif
+
+//
+// Student's t
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Student's t distribution
+ *
+ * @param n the number of output rows (points).
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qt.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqt<arma::mat>(1024,5.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqt(const ullint_t n, const T1 dof_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[dof_par](const double p){ return qt(p,dof_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Student's t distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1>
+statslib_inline
+mT
+rqt(const ullint_t n, const ullint_t k, const T1 dof_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqt<mT>(n,dof_par,qmc_gen);
+}
+#endif
+
+//
+// F
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the F distribution
+ *
+ * @param n the number of output rows (points).
+ * @param df1_par a degrees of freedom parameter, a real-valued input.
+ * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qf.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqf<arma::mat>(1024,3.0,4.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqf(const ullint_t n, const T1 df1_par, const T2 df2_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[df1_par,df2_par](const double p){ return qf(p,df1_par,df2_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the F distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param df1_par a degrees of freedom parameter, a real-valued input.
+ * @param df2_par a degrees of freedom parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqf<mT>(n,df1_par,df2_par,qmc_gen);
+}
+#endif
+
+//
+// Cauchy
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Cauchy distribution
+ *
+ * @param n the number of output rows (points).
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qcauchy.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqcauchy<arma::mat>(1024,1.0,2.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqcauchy(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[mu_par,sigma_par](const double p){ return qcauchy(p,mu_par,sigma_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Cauchy distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqcauchy<mT>(n,mu_par,sigma_par,qmc_gen);
+}
+#endif
+
+//
+// Laplace
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Laplace distribution
+ *
+ * @param n the number of output rows (points).
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qlaplace.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqlaplace<arma::mat>(1024,1.0,2.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqlaplace(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[mu_par,sigma_par](const double p){ return qlaplace(p,mu_par,sigma_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Laplace distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqlaplace(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqlaplace<mT>(n,mu_par,sigma_par,qmc_gen);
+}
+#endif
+
+//
+// Logistic
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Logistic distribution
+ *
+ * @param n the number of output rows (points).
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qlogis.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqlogis<arma::mat>(1024,1.0,2.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqlogis(const ullint_t n, const T1 mu_par, const T2 sigma_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[mu_par,sigma_par](const double p){ return qlogis(p,mu_par,sigma_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Logistic distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqlogis<mT>(n,mu_par,sigma_par,qmc_gen);
+}
+#endif
+
+//
+// Weibull
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Weibull distribution
+ *
+ * @param n the number of output rows (points).
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ * @param qmc_gen a point sequence, passed by reference: a low-discrepancy sequence (\c stats::sobol_seq, \c stats::halton_seq) or a sampling design (\c stats::antithetic_design, \c stats::stratified_design, \c stats::lhs_design).
+ *
+ * @return an \c n-by-\c d matrix of draws, where \c d is the dimension of \c qmc_gen, computed with \c qweibull.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(4,engine);
+ * stats::rqweibull<arma::mat>(1024,2.0,3.0,sobol_gen);
+ * \endcode
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename qmcT, typename enable_if_qmc<qmcT>::type*>
+statslib_inline
+mT
+rqweibull(const ullint_t n, const T1 shape_par, const T2 scale_par, qmcT& qmc_gen)
+{
+    return rqmc<mT>(n,[shape_par,scale_par](const double p){ return qweibull(p,shape_par,scale_par); },qmc_gen);
+}
+#endif
+
+/**
+ * @brief Quasi-Monte Carlo sampling function for the Weibull distribution
+ *
+ * @param n the number of output rows (points).
+ * @param k the number of output columns (dimensions), at most \c STATS_SOBOL_MAX_DIM.
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ *
+ * @return an \c n-by-\c k matrix of quasi-random draws from a scrambled Sobol sequence, with scrambling drawn from the default engine of the calling thread.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2>
+statslib_inline
+mT
+rqweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par)
+{
+    sobol_seq qmc_gen(k,internal::default_engine());
+
+    return rqweibull<mT>(n,shape_par,scale_par,qmc_gen);
+}
+#endif
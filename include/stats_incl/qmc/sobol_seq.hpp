@@ -0,0 +1,96 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sobol low-discrepancy sequence
+ */
+
+#ifndef _statslib_sobol_seq_HPP
+#define _statslib_sobol_seq_HPP
+
+#include "sobol_dir_nums.hpp"
+
+#define STATS_SOBOL_N_BITS ullint_t(52)
+
+/**
+ * @brief Sobol low-discrepancy sequence
+ *
+ * Generates the points of a Sobol (1967) sequence in up to \c STATS_SOBOL_MAX_DIM (1024) dimensions,
+ * using the direction numbers of Joe and Kuo (2008) and the Gray code ordering of Antonov and Saleev (1979).
+ * Points are returned with 52 bits of resolution, and each coordinate lies at the center of its
+ * dyadic cell, so that all values are in the open interval (0,1); at most 2^52 points can be generated.
+ *
+ * The sequence is either deterministic, in which case the initial point (the origin) is skipped,
+ * or randomized with a random linear matrix scramble and a random digital shift (Matousek, 1998; Owen, 2003),
+ * which keeps the net properties of the sequence and makes every point uniformly distributed; in the latter
+ * case the sequence starts at the origin, and the first 2^m points form a scrambled (t,m,d)-net.
+ *
+ * If the number of dimensions is zero or exceeds \c STATS_SOBOL_MAX_DIM, or the sequence is exhausted,
+ * the generated points are NaN.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::sobol_seq sobol_gen(3,engine); // scrambled
+ *
+ * std::vector<double> point(3);
+ * sobol_gen.next(point.data());
+ * \endcode
+ */
+
+class sobol_seq
+{
+    public:
+        explicit sobol_seq(const ullint_t n_dim);
+
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        sobol_seq(const ullint_t n_dim, rngT& engine);
+
+        ullint_t dim() const;
+        ullint_t index() const;
+        bool scrambled() const;
+
+        void next(double* vals_out);
+
+        void discard(const ullint_t n_skip);
+        void reset();
+
+    private:
+        ullint_t n_dim_ = 0;
+        bool scrambled_ = false;
+        ullint_t point_ind_ = 0;
+
+        std::vector<ullint_t> dir_nums_; // n_dim x STATS_SOBOL_N_BITS, stored by dimension
+        std::vector<ullint_t> shift_;
+        std::vector<ullint_t> state_;
+
+        void init_dir_nums();
+        void set_state(const ullint_t ind);
+
+        template<typename rngT>
+        void scramble(rngT& engine);
+};
+
+//
+// include implementation files
+
+#include "sobol_seq.ipp"
+
+#endif
@@ -0,0 +1,285 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sobol low-discrepancy sequence
+ */
+
+/**
+ * @brief Deterministic Sobol sequence
+ *
+ * @param n_dim the number of dimensions, between 1 and \c STATS_SOBOL_MAX_DIM.
+ *
+ * The sequence starts at its second point, as the first is the origin.
+ */
+
+statslib_inline
+sobol_seq::sobol_seq(const ullint_t n_dim)
+: n_dim_(n_dim), scrambled_(false)
+{
+    init_dir_nums();
+    reset();
+}
+
+/**
+ * @brief Scrambled Sobol sequence
+ *
+ * @param n_dim the number of dimensions, between 1 and \c STATS_SOBOL_MAX_DIM.
+ * @param engine a random engine, passed by reference, used to draw the scrambling matrices and digital shifts.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+sobol_seq::sobol_seq(const ullint_t n_dim, rngT& engine)
+: n_dim_(n_dim), scrambled_(true)
+{
+    init_dir_nums();
+    scramble(engine);
+    reset();
+}
+
+statslib_inline
+ullint_t
+sobol_seq::dim()
+const
+{
+    return n_dim_;
+}
+
+/**
+ * @brief The number of points generated (or discarded) since construction or the last call to \c reset
+ */
+
+statslib_inline
+ullint_t
+sobol_seq::index()
+const
+{
+    return scrambled_ ? point_ind_ : point_ind_ - ullint_t(1);
+}
+
+statslib_inline
+bool
+sobol_seq::scrambled()
+const
+{
+    return scrambled_;
+}
+
+/**
+ * @brief Generate the next point of the sequence
+ *
+ * @param vals_out a pointer to \c dim() values, which are overwritten.
+ */
+
+statslib_inline
+void
+sobol_seq::next(double* vals_out)
+{
+    const ullint_t max_ind = ullint_t(1) << STATS_SOBOL_N_BITS;
+
+    if (dir_nums_.empty() || point_ind_ >= max_ind)
+    {
+        for (ullint_t j = 0; j < n_dim_; ++j) {
+            vals_out[j] = STLIM<double>::quiet_NaN();
+        }
+
+        return;
+    }
+
+    const double bit_scale = 1.0 / static_cast<double>(max_ind);
+
+    for (ullint_t j = 0; j < n_dim_; ++j) {
+        vals_out[j] = (static_cast<double>(state_[j]) + 0.5) * bit_scale;
+    }
+
+    // Gray code update: the next point differs from the current one by the direction number
+    // indexed by the lowest zero bit of the current index
+
+    ullint_t bit_ind = 0;
+
+    for (ullint_t ind = point_ind_; ind & ullint_t(1); ind >>= 1) {
+        ++bit_ind;
+    }
+
+    ++point_ind_;
+
+    if (bit_ind < STATS_SOBOL_N_BITS)
+    {
+        for (ullint_t j = 0; j < n_dim_; ++j) {
+            state_[j] ^= dir_nums_[j*STATS_SOBOL_N_BITS + bit_ind];
+        }
+    }
+}
+
+/**
+ * @brief Skip the next \c n_skip points of the sequence
+ */
+
+statslib_inline
+void
+sobol_seq::discard(const ullint_t n_skip)
+{
+    const ullint_t max_ind = ullint_t(1) << STATS_SOBOL_N_BITS;
+
+    set_state( (n_skip < max_ind - point_ind_) ? point_ind_ + n_skip : max_ind );
+}
+
+/**
+ * @brief Restart the sequence from its first point
+ */
+
+statslib_inline
+void
+sobol_seq::reset()
+{
+    set_state(scrambled_ ? ullint_t(0) : ullint_t(1));
+}
+
+statslib_inline
+void
+sobol_seq::init_dir_nums()
+{
+    dir_nums_.clear();
+
+    if (n_dim_ == ullint_t(0) || n_dim_ > STATS_SOBOL_MAX_DIM) {
+        return;
+    }
+
+    dir_nums_.resize(n_dim_*STATS_SOBOL_N_BITS);
+    shift_.assign(n_dim_,ullint_t(0));
+    state_.assign(n_dim_,ullint_t(0));
+
+    // v_k = m_k / 2^k, stored with STATS_SOBOL_N_BITS bits; the first dimension has m_k = 1
+
+    for (ullint_t k = 0; k < STATS_SOBOL_N_BITS; ++k) {
+        dir_nums_[k] = ullint_t(1) << (STATS_SOBOL_N_BITS - k - 1U);
+    }
+
+    const unsigned short* poly_vals = internal::sobol_poly();
+    const unsigned short* minit_vals = internal::sobol_minit();
+
+    ullint_t minit_ind = 0;
+
+    for (ullint_t j = 1; j < n_dim_; ++j)
+    {
+        const ullint_t poly_j = poly_vals[j-1];
+
+        ullint_t poly_deg = 0;
+        while ((poly_j >> (poly_deg + 1U)) != ullint_t(0)) {
+            ++poly_deg;
+        }
+
+        ullint_t* dir_nums_j = &dir_nums_[j*STATS_SOBOL_N_BITS];
+
+        for (ullint_t k = 0; k < poly_deg; ++k) {
+            dir_nums_j[k] = static_cast<ullint_t>(minit_vals[minit_ind + k]) << (STATS_SOBOL_N_BITS - k - 1U);
+        }
+
+        minit_ind += poly_deg;
+
+        // recurrence defined by the coefficients a_1, ..., a_{s-1} of the primitive polynomial
+
+        for (ullint_t k = poly_deg; k < STATS_SOBOL_N_BITS; ++k)
+        {
+            ullint_t dir_val = dir_nums_j[k - poly_deg] ^ (dir_nums_j[k - poly_deg] >> poly_deg);
+
+            for (ullint_t i = 1; i < poly_deg; ++i)
+            {
+                if ((poly_j >> (poly_deg - i)) & ullint_t(1)) {
+                    dir_val ^= dir_nums_j[k - i];
+                }
+            }
+
+            dir_nums_j[k] = dir_val;
+        }
+    }
+}
+
+statslib_inline
+void
+sobol_seq::set_state(const ullint_t ind)
+{
+    point_ind_ = ind;
+
+    if (dir_nums_.empty() || ind >= (ullint_t(1) << STATS_SOBOL_N_BITS)) {
+        return;
+    }
+
+    const ullint_t gray_ind = ind ^ (ind >> 1);
+
+    for (ullint_t j = 0; j < n_dim_; ++j)
+    {
+        ullint_t state_j = shift_[j];
+
+        for (ullint_t k = 0; k < STATS_SOBOL_N_BITS; ++k)
+        {
+            if ((gray_ind >> k) & ullint_t(1)) {
+                state_j ^= dir_nums_[j*STATS_SOBOL_N_BITS + k];
+            }
+        }
+
+        state_[j] = state_j;
+    }
+}
+
+// linear matrix scrambling: the digits of each coordinate are multiplied by a random nonsingular
+// lower-triangular matrix over GF(2), i.e., digit t of the output is the sum of input digit t
+// and a random subset of the preceding (more significant) digits; applied to the direction numbers,
+// this scrambles every point of the sequence at no extra cost
+
+template<typename rngT>
+statslib_inline
+void
+sobol_seq::scramble(rngT& engine)
+{
+    if (dir_nums_.empty()) {
+        return;
+    }
+
+    const ullint_t bits_mask = (ullint_t(1) << STATS_SOBOL_N_BITS) - ullint_t(1);
+
+    ullint_t lms_rows[STATS_SOBOL_N_BITS];
+
+    for (ullint_t j = 0; j < n_dim_; ++j)
+    {
+        for (ullint_t t = 0; t < STATS_SOBOL_N_BITS; ++t)
+        {
+            const ullint_t prev_digits = (t == ullint_t(0)) ? ullint_t(0) : (~ullint_t(0) << (STATS_SOBOL_N_BITS - t)) & bits_mask;
+
+            lms_rows[t] = (internal::rand_bits64(engine) & prev_digits) | (ullint_t(1) << (STATS_SOBOL_N_BITS - t - 1U));
+        }
+
+        ullint_t* dir_nums_j = &dir_nums_[j*STATS_SOBOL_N_BITS];
+
+        for (ullint_t k = 0; k < STATS_SOBOL_N_BITS; ++k)
+        {
+            ullint_t dir_val = 0;
+
+            for (ullint_t t = 0; t < STATS_SOBOL_N_BITS; ++t) {
+                dir_val |= (internal::popcount64(lms_rows[t] & dir_nums_j[k]) & ullint_t(1)) << (STATS_SOBOL_N_BITS - t - 1U);
+            }
+
+            dir_nums_j[k] = dir_val;
+        }
+
+        shift_[j] = internal::rand_bits64(engine) & bits_mask;
+    }
+}
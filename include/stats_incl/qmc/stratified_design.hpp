@@ -0,0 +1,75 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Stratified sampling design
+ */
+
+#ifndef _statslib_stratified_design_HPP
+#define _statslib_stratified_design_HPP
+
+/**
+ * @brief Stratified (jittered) sampling design
+ *
+ * Each axis of (0,1)^d is divided into \c n_strata intervals, and the design visits the resulting
+ * <tt>n_strata^d</tt> cells in turn, drawing one uniform point in each; a full pass over the cells
+ * removes the between-cell component of the variance of the sample mean. Sample sizes should be multiples of
+ * <tt>n_strata^d</tt>, as the cells are visited in a fixed order, and each new pass draws new points.
+ *
+ * The design holds its own random engine, seeded from the engine passed to the constructor. If the number of cells
+ * overflows, or \c n_strata is zero, the generated points are NaN.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::stratified_design strat_design(10,2,engine); // 100 cells
+ * stats::rqnorm<arma::mat>(1000,0.0,1.0,strat_design);
+ * \endcode
+ */
+
+class stratified_design
+{
+    public:
+        template<typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+        stratified_design(const ullint_t n_strata, const ullint_t n_dim, rngT& engine);
+
+        ullint_t dim() const;
+        ullint_t index() const;
+        ullint_t n_cells() const;
+
+        void next(double* vals_out);
+        void reset();
+
+    private:
+        ullint_t n_strata_ = 0;
+        ullint_t n_dim_ = 0;
+        ullint_t n_cells_ = 0;
+        ullint_t point_ind_ = 0;
+
+        ullint_t seed_val_ = 0;
+        xoshiro256pp engine_;
+};
+
+//
+// include implementation files
+
+#include "stratified_design.ipp"
+
+#endif
@@ -0,0 +1,130 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Stratified sampling design
+ */
+
+/**
+ * @brief Stratified sampling design
+ *
+ * @param n_strata the number of intervals per axis.
+ * @param n_dim the number of dimensions.
+ * @param engine a random engine, passed by reference, used to seed the design.
+ */
+
+template<typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+stratified_design::stratified_design(const ullint_t n_strata, const ullint_t n_dim, rngT& engine)
+: n_strata_(n_strata), n_dim_(n_dim), seed_val_(internal::rand_bits64(engine))
+{
+    // number of cells, or zero on overflow
+
+    n_cells_ = (n_strata > ullint_t(0)) ? ullint_t(1) : ullint_t(0);
+
+    for (ullint_t j = 0; j < n_dim && n_cells_ > ullint_t(0); ++j) {
+        n_cells_ = (n_cells_ <= STLIM<ullint_t>::max() / n_strata) ? n_cells_ * n_strata : ullint_t(0);
+    }
+
+    reset();
+}
+
+statslib_inline
+ullint_t
+stratified_design::dim()
+const
+{
+    return n_dim_;
+}
+
+/**
+ * @brief The number of points generated since construction or the last call to \c reset
+ */
+
+statslib_inline
+ullint_t
+stratified_design::index()
+const
+{
+    return point_ind_;
+}
+
+/**
+ * @brief The number of cells, <tt>n_strata^d</tt>, visited in each pass
+ */
+
+statslib_inline
+ullint_t
+stratified_design::n_cells()
+const
+{
+    return n_cells_;
+}
+
+/**
+ * @brief Generate the next point of the design
+ *
+ * @param vals_out a pointer to \c dim() values, which are overwritten.
+ */
+
+statslib_inline
+void
+stratified_design::next(double* vals_out)
+{
+    if (n_cells_ == ullint_t(0))
+    {
+        for (ullint_t j = 0; j < n_dim_; ++j) {
+            vals_out[j] = STLIM<double>::quiet_NaN();
+        }
+
+        return;
+    }
+
+    const double unif_max = 1.0 - STLIM<double>::epsilon() / 2.0;
+    const double n_strata_d = static_cast<double>(n_strata_);
+
+    // the digits of the cell index, in base n_strata, give the interval of each coordinate
+
+    ullint_t cell_ind = point_ind_ % n_cells_;
+
+    for (ullint_t j = 0; j < n_dim_; ++j)
+    {
+        const ullint_t stratum_j = cell_ind % n_strata_;
+        cell_ind /= n_strata_;
+
+        const double u_j = (static_cast<double>(stratum_j) + internal::rand_unif53_open(engine_)) / n_strata_d;
+
+        vals_out[j] = std::min(u_j, unif_max);
+    }
+
+    ++point_ind_;
+}
+
+/**
+ * @brief Restart the design; the same points are generated again
+ */
+
+statslib_inline
+void
+stratified_design::reset()
+{
+    engine_.seed(seed_val_);
+    point_ind_ = 0;
+}
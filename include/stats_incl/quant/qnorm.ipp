@@ -28,13 +28,15 @@
 namespace internal
 {
 
+// Wichura's AS241 (internal_fns/qnorm_kernel.hpp), accurate to about 1e-16
+
 template<typename T>
 statslib_constexpr
 T
 qnorm_compute(const T p, const T mu_par, const T sigma_par)
 noexcept
 {
-    return( mu_par + T(GCEM_SQRT_2)*sigma_par*gcem::erf_inv( T(2)*p - T(1) ) );
+    return( mu_par + sigma_par*qnorm_as241(p) );
 }
 
 template<typename T>
@@ -133,7 +135,33 @@ void
 qnorm_vec(const eT* __stats_pointer_settings__ vals_in, const T1 mu_par, const T2 sigma_par, 
                 rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    EVAL_DIST_FN_VEC(qnorm,vals_in,vals_out,num_elem,mu_par,sigma_par);
+    const double mu_par_d = static_cast<double>(mu_par);
+    const double sigma_par_d = static_cast<double>(sigma_par);
+
+    // parameters on the boundary of the parameter space are left to the scalar function
+
+    if (!(GCINT::all_finite(mu_par_d,sigma_par_d) && sigma_par_d > 0.0)) {
+        EVAL_DIST_FN_VEC(qnorm,vals_in,vals_out,num_elem,mu_par,sigma_par);
+        return;
+    }
+
+    dens_batch_eval(vals_in,vals_out,num_elem,0.5,
+        [=](const double p) { return p >= STLIM<double>::min() && p < 1.0; },
+        [=](const double* p_vals, double* vals, const ullint_t n_vals)
+        {
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = p_vals[j];
+            }
+
+            batch_qnorm(vals,n_vals);
+
+            STATS_SIMD_LOOP
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = mu_par_d + sigma_par_d*vals[j];
+            }
+        },
+        [=](const eT p) { return qnorm(p,mu_par,sigma_par); });
 }
 #endif
 
@@ -0,0 +1,78 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Alias table for sampling from a discrete (categorical) distribution
+ */
+
+#ifndef _statslib_alias_table_HPP
+#define _statslib_alias_table_HPP
+
+/**
+ * @brief Alias table for O(1) sampling from a categorical distribution
+ *
+ * The table is built in O(k) time from k non-negative weights, which need not sum to one,
+ * using Vose's (1991) variant of Walker's alias method. Each draw then costs one call to the
+ * random engine and returns an index in <tt>{0, ..., k-1}</tt>, selected with probability
+ * proportional to its weight.
+ *
+ * If the weights are invalid (empty, negative, NaN, or summing to zero), the table is empty
+ * and draws return <tt>std::numeric_limits<ullint_t>::max()</tt>.
+ *
+ * Example:
+ * \code{.cpp}
+ * std::vector<double> weights = {0.1, 0.2, 0.7};
+ * stats::alias_table cat_table(weights);
+ *
+ * stats::rand_engine_t engine(1776);
+ * stats::ullint_t ind = cat_table(engine);
+ * \endcode
+ */
+
+class alias_table
+{
+    public:
+        alias_table() = default;
+
+        alias_table(const double* weights, const ullint_t n_weights);
+
+        explicit alias_table(const std::vector<double>& weights);
+
+        ullint_t size() const;
+
+        template<typename rngT>
+        ullint_t operator()(rngT& engine) const;
+
+        double prob(const ullint_t ind) const;
+
+    private:
+        std::vector<double> accept_prob_;
+        std::vector<ullint_t> alias_ind_;
+        std::vector<double> norm_weights_;
+
+        void build(const double* weights, const ullint_t n_weights);
+};
+
+//
+// include implementation files
+
+#include "alias_table.ipp"
+
+#endif
@@ -0,0 +1,167 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Alias table for sampling from a discrete (categorical) distribution
+ */
+
+statslib_inline
+alias_table::alias_table(const double* weights, const ullint_t n_weights)
+{
+    build(weights,n_weights);
+}
+
+statslib_inline
+alias_table::alias_table(const std::vector<double>& weights)
+{
+    build(weights.data(),weights.size());
+}
+
+/**
+ * @brief The number of categories in the table
+ */
+
+statslib_inline
+ullint_t
+alias_table::size()
+const
+{
+    return accept_prob_.size();
+}
+
+/**
+ * @brief The (normalized) probability of category \c ind
+ */
+
+statslib_inline
+double
+alias_table::prob(const ullint_t ind)
+const
+{
+    return ind < norm_weights_.size() ? norm_weights_[ind] : 0.0;
+}
+
+/**
+ * @brief Draw a category index
+ *
+ * @param engine a random engine, passed by reference.
+ *
+ * @return an index in <tt>{0, ..., size()-1}</tt>.
+ */
+
+template<typename rngT>
+statslib_inline
+ullint_t
+alias_table::operator()(rngT& engine)
+const
+{
+    const ullint_t n_cat = accept_prob_.size();
+
+    if (n_cat == ullint_t(0)) {
+        return STLIM<ullint_t>::max();
+    }
+
+    // a single uniform gives both the column and the coin flip
+
+    const double u = internal::rand_unif53(engine) * static_cast<double>(n_cat);
+
+    ullint_t ind = static_cast<ullint_t>(u);
+    ind = (ind < n_cat) ? ind : n_cat - 1U;
+
+    return (u - static_cast<double>(ind) < accept_prob_[ind]) ? ind : alias_ind_[ind];
+}
+
+statslib_inline
+void
+alias_table::build(const double* weights, const ullint_t n_weights)
+{
+    accept_prob_.clear();
+    alias_ind_.clear();
+    norm_weights_.clear();
+
+    double weight_sum = 0.0;
+
+    for (ullint_t i = 0; i < n_weights; ++i)
+    {
+        if (!(weights[i] >= 0.0) || GCINT::is_posinf(weights[i])) {
+            return; // negative, NaN, or infinite weight
+        }
+
+        weight_sum += weights[i];
+    }
+
+    if (!(weight_sum > 0.0)) {
+        return;
+    }
+
+    //
+
+    accept_prob_.resize(n_weights);
+    alias_ind_.resize(n_weights);
+    norm_weights_.resize(n_weights);
+
+    std::vector<double> scaled_prob(n_weights);
+    std::vector<ullint_t> small_ind, large_ind;
+
+    small_ind.reserve(n_weights);
+    large_ind.reserve(n_weights);
+
+    for (ullint_t i = 0; i < n_weights; ++i)
+    {
+        norm_weights_[i] = weights[i] / weight_sum;
+        scaled_prob[i] = norm_weights_[i] * n_weights;
+
+        if (scaled_prob[i] < 1.0) {
+            small_ind.push_back(i);
+        } else {
+            large_ind.push_back(i);
+        }
+    }
+
+    while (!small_ind.empty() && !large_ind.empty())
+    {
+        const ullint_t s_ind = small_ind.back();
+        const ullint_t l_ind = large_ind.back();
+
+        small_ind.pop_back();
+
+        accept_prob_[s_ind] = scaled_prob[s_ind];
+        alias_ind_[s_ind] = l_ind;
+
+        scaled_prob[l_ind] = (scaled_prob[l_ind] + scaled_prob[s_ind]) - 1.0;
+
+        if (scaled_prob[l_ind] < 1.0) {
+            large_ind.pop_back();
+            small_ind.push_back(l_ind);
+        }
+    }
+
+    // remaining entries are (up to rounding) exactly one
+
+    for (ullint_t i : large_ind) {
+        accept_prob_[i] = 1.0;
+        alias_ind_[i] = i;
+    }
+
+    for (ullint_t i : small_ind) {
+        accept_prob_[i] = 1.0;
+        alias_ind_[i] = i;
+    }
+}
@@ -26,6 +26,8 @@
 
 #include "rgamma.hpp"
 
+#include "alias_table.hpp"
+
 #include "rbern.hpp"
 #include "rbeta.hpp"
 #include "rbinom.hpp"
@@ -42,6 +44,8 @@
 #include "rmvnorm.hpp"
 #include "rpois.hpp"
 #include "rt.hpp"
+#include "rtnorm.hpp"
+#include "rtrunc.hpp"
 #include "rweibull.hpp"
 #include "rwish.hpp"
 
@@ -28,15 +28,20 @@
 //
 // scalar output
 
-template<typename T>
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
 statslib_inline
 return_t<T> 
-rbern(const T prob_par, rand_engine_t& engine);
+rbern(const T prob_par, rngT& engine);
+
+template<typename T>
+statslib_inline
+return_t<T>
+rbern(const T prob_par, const ullint_t seed_val);
 
 template<typename T>
 statslib_inline
 return_t<T>
-rbern(const T prob_par, const ullint_t seed_val = std::random_device{}());
+rbern(const T prob_par);
 
 //
 // vector/matrix output
@@ -45,7 +50,14 @@ rbern(const T prob_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rbern(const ullint_t n, const ullint_t k, const T1 prob_par);
+rbern(const ullint_t n, const ullint_t k, const T1 prob_par,
+      const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rbern(const ullint_t n, const ullint_t k, const T1 prob_par,
+      rngT& engine);
 #endif
 
 //
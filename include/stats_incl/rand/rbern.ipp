@@ -22,6 +22,80 @@
  * Sample from a Bernoulli distribution
  */
 
+namespace internal
+{
+
+// 64 independent Bernoulli draws packed into the bits of one word.
+// Each bit position holds a uniform whose binary digits are revealed one engine call at a time
+// and compared against the binary expansion of prob_par; a position is decided at the first
+// digit where the two differ, so about log2(64) + 2 calls are needed on average. Every double
+// has a finite binary expansion, so the draws are exact; p = k/2^m needs at most m calls.
+
+template<typename rngT>
+statslib_inline
+ullint_t
+rbern_bits64(const double prob_par, rngT& engine)
+{
+    if (prob_par <= 0.0) {
+        return ullint_t(0);
+    }
+
+    if (prob_par >= 1.0) {
+        return ~ullint_t(0);
+    }
+
+    ullint_t ret = ullint_t(0);
+    ullint_t undecided = ~ullint_t(0);
+
+    // the first 64 digits of p as a fixed-point integer, and the remainder beyond them;
+    // scaling by 2^64 is exact, as is the subtraction
+
+    const double prob_scaled = prob_par * 18446744073709551616.0;
+
+    ullint_t prob_digits = static_cast<ullint_t>(prob_scaled);
+    double prob_rem = prob_scaled - static_cast<double>(prob_digits);
+
+    for (uint_t digit_ind = 0U; digit_ind < 64U; ++digit_ind)
+    {
+        if (undecided == ullint_t(0) || (prob_digits == ullint_t(0) && prob_rem == 0.0)) {
+            return ret;
+        }
+
+        const ullint_t rand_digits = rand_bits64(engine);
+        const ullint_t prob_digit_mask = ullint_t(0) - (prob_digits >> 63);
+
+        // digit of p is 1: positions with a 0 digit fall below p;
+        // digit of p is 0: positions with a 1 digit rise above p.
+
+        ret |= undecided & ~rand_digits & prob_digit_mask;
+        undecided &= ~(rand_digits ^ prob_digit_mask);
+
+        prob_digits <<= 1;
+    }
+
+    // any further digits of p (reached with probability below 2^-58)
+
+    while (undecided != ullint_t(0) && prob_rem > 0.0)
+    {
+        const ullint_t rand_digits = rand_bits64(engine);
+
+        prob_rem *= 2.0; // doubling and subtracting one are exact
+
+        const bool prob_digit = (prob_rem >= 1.0);
+        const ullint_t prob_digit_mask = ullint_t(0) - static_cast<ullint_t>(prob_digit);
+
+        ret |= undecided & ~rand_digits & prob_digit_mask;
+        undecided &= ~(rand_digits ^ prob_digit_mask);
+        prob_rem -= prob_digit ? 1.0 : 0.0;
+    }
+
+    // positions still undecided match p exactly in every digit, i.e., u >= p
+
+    return ret;
+}
+
+}
+
 //
 // scalar output
 
@@ -40,15 +114,15 @@
  * \endcode
  */
 
-template<typename T>
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 return_t<T> 
-rbern(const T prob_par, rand_engine_t& engine)
+rbern(const T prob_par, rngT& engine)
 {
     return( !internal::bern_sanity_check(prob_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            runif(T(0),T(1),engine) <= prob_par );
+            internal::rand_unif53(engine) < static_cast<double>(prob_par) );
 }
 
 /**
@@ -74,6 +148,29 @@ rbern(const T prob_par, const ullint_t seed_val)
     return rbern(prob_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Bernoulli distribution
+ *
+ * @param prob_par the probability parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Bernoulli distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rbern(0.7);
+ * \endcode
+ */
+
+template<typename T>
+statslib_inline
+return_t<T>
+rbern(const T prob_par)
+{
+    return rbern(prob_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -81,12 +178,52 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+// bulk fill: 64 draws per packed word
+
+template<typename T1, typename rngT, typename rT>
+statslib_inline
+void
+rbern_fill(const T1 prob_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    if (!bern_sanity_check(prob_par))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<return_t<T1>>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    const double prob_par_d = static_cast<double>(prob_par);
+
+    for (ullint_t j=ullint_t(0); j < num_elem; j += ullint_t(64))
+    {
+        ullint_t draw_bits = rbern_bits64(prob_par_d,engine);
+
+        const ullint_t n_bits = std::min(ullint_t(64), num_elem - j);
+
+        for (ullint_t i=ullint_t(0); i < n_bits; ++i)
+        {
+            vals_out[j + i] = static_cast<rT>(draw_bits & ullint_t(1));
+            draw_bits >>= 1;
+        }
+    }
+}
+
 template<typename T1, typename rT>
 statslib_inline
 void
-rbern_vec(const T1 prob_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rbern_vec(const T1 prob_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rbern,vals_out,num_elem,prob_par);
+    RAND_DIST_FN_VEC_FILL(rbern_fill,vals_out,num_elem,seed_val,prob_par);
+}
+
+template<typename T1, typename rngT, typename rT>
+statslib_inline
+void
+rbern_vec(const T1 prob_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    rbern_fill(prob_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -94,9 +231,17 @@ rbern_vec(const T1 prob_par, rT* __stats_pointer_settings__ vals_out, const ulli
 template<typename eT, typename T1>
 statslib_inline
 void
-rbern_mat_check(std::vector<eT>& X, const T1 prob_par)
+rbern_mat_check(std::vector<eT>& X, const T1 prob_par, const ullint_t seed_val)
+{
+    STDVEC_RAND_DIST_FN(rbern,prob_par,seed_val);
+}
+
+template<typename eT, typename T1, typename rngT>
+statslib_inline
+void
+rbern_mat_check(std::vector<eT>& X, const T1 prob_par, rngT& engine)
 {
-    STDVEC_RAND_DIST_FN(rbern,prob_par);
+    STDVEC_RAND_DIST_FN(rbern,prob_par,engine);
 }
 #endif
 
@@ -104,9 +249,17 @@ rbern_mat_check(std::vector<eT>& X, const T1 prob_par)
 template<typename mT, typename T1>
 statslib_inline
 void
-rbern_mat_check(mT& X, const T1 prob_par)
+rbern_mat_check(mT& X, const T1 prob_par, const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rbern,prob_par,seed_val);
+}
+
+template<typename mT, typename T1, typename rngT>
+statslib_inline
+void
+rbern_mat_check(mT& X, const T1 prob_par, rngT& engine)
 {
-    MAIN_MAT_RAND_DIST_FN(rbern,prob_par);
+    MAIN_MAT_RAND_DIST_FN(rbern,prob_par,engine);
 }
 #endif
 
@@ -118,6 +271,7 @@ rbern_mat_check(mT& X, const T1 prob_par)
  * @param n the number of output rows
  * @param k the number of output columns
  * @param prob_par the probability parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Bernoulli distribution.
  *
@@ -133,6 +287,8 @@ rbern_mat_check(mT& X, const T1 prob_par)
  * stats::rbern<Eigen::MatrixXd>(5,4,0.7);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -140,8 +296,46 @@ rbern_mat_check(mT& X, const T1 prob_par)
 template<typename mT, typename T1>
 statslib_inline
 mT
-rbern(const ullint_t n, const ullint_t k, const T1 prob_par)
+rbern(const ullint_t n, const ullint_t k, const T1 prob_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rbern_mat_check,prob_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Bernoulli distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param prob_par the probability parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Bernoulli distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rbern<std::vector<double>>(5,4,0.7,engine);
+ * // Armadillo matrix
+ * stats::rbern<arma::mat>(5,4,0.7,engine);
+ * // Blaze dynamic matrix
+ * stats::rbern<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,0.7,engine);
+ * // Eigen dynamic matrix
+ * stats::rbern<Eigen::MatrixXd>(5,4,0.7,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rbern(const ullint_t n, const ullint_t k, const T1 prob_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rbern_mat_check,prob_par);
+    GEN_MAT_RAND_FN(rbern_mat_check,prob_par,engine);
 }
 #endif
@@ -28,27 +28,126 @@
 namespace internal
 {
 
+// per-parameter constants of the Beta sampler: Johnk's (1964) method is used if both shapes
+// are at most one; otherwise X/(X+Y) is formed from two Gamma draws with precomputed
+// Marsaglia-Tsang constants, which is faster than Cheng's (1978) algorithms BB and BC
+
+struct rbeta_pars
+{
+    bool use_johnk;
+
+    double inv_a;
+    double inv_b;
+
+    rgamma_mt_pars gamma_a;
+    rgamma_mt_pars gamma_b;
+
+    explicit rbeta_pars(const double a_par, const double b_par)
+        : use_johnk(a_par <= 1.0 && b_par <= 1.0),
+          inv_a(1.0 / a_par),
+          inv_b(1.0 / b_par),
+          gamma_a(a_par),
+          gamma_b(b_par)
+    {}
+};
+
+// a draw X is returned as the ratio 'num_val / (num_val + den_val)', so that X/(1-X) = num_val / den_val
+// is also available without cancellation (see rf)
+
+template<typename rngT>
+statslib_inline
+void
+rbeta_draw_ratio(const rbeta_pars& pars, rngT& engine, double& num_val, double& den_val)
+{
+    if (!pars.use_johnk)
+    {
+        num_val = rgamma_mt_draw(pars.gamma_a,engine);
+        den_val = rgamma_mt_draw(pars.gamma_b,engine);
+
+        return;
+    }
+
+    while (true)
+    {
+        const double log_x = std::log(rand_unif53_open(engine)) * pars.inv_a;
+        const double log_y = std::log(rand_unif53_open(engine)) * pars.inv_b;
+
+        const double x = std::exp(log_x);
+        const double y = std::exp(log_y);
+
+        if (x + y <= 1.0)
+        {
+            if (x + y > 0.0) {
+                num_val = x;
+                den_val = y;
+            } else {
+                // both terms underflow: rescale in log-space
+                const double log_m = std::max(log_x,log_y);
+
+                num_val = std::exp(log_x - log_m);
+                den_val = std::exp(log_y - log_m);
+            }
+
+            return;
+        }
+    }
+}
+
+// limiting cases: zero or infinite shape parameters
+
 template<typename T>
 statslib_inline
+bool
+rbeta_is_limit_case(const T a_par, const T b_par)
+{
+    return( a_par == T(0) || b_par == T(0) || GCINT::any_inf(a_par,b_par) );
+}
+
+template<typename T, typename rngT>
+statslib_inline
+T
+rbeta_limit_vals(const T a_par, const T b_par, rngT& engine)
+{
+    return( // both shapes zero: point masses at 0 and 1 with equal weight
+            (a_par == T(0) && b_par == T(0)) ? \
+                T(rand_unif53(engine) < 0.5 ? 0 : 1) :
+            // both shapes infinite: point mass at 1/2
+            (GCINT::is_posinf(a_par) && GCINT::is_posinf(b_par)) ? \
+                T(0.5) :
+            //
+            (a_par == T(0) || GCINT::is_posinf(b_par)) ? \
+                T(0) :
+            //
+                T(1) );
+}
+
+template<typename T, typename rngT>
+statslib_inline
 T
-rbeta_compute(const T a_par, const T b_par, rand_engine_t& engine)
+rbeta_compute(const T a_par, const T b_par, rngT& engine)
 {
     if (!beta_sanity_check(a_par,b_par)) {
         return STLIM<T>::quiet_NaN();
     }
 
+    if (rbeta_is_limit_case(a_par,b_par)) {
+        return rbeta_limit_vals(a_par,b_par,engine);
+    }
+
     //
-    
-    const T X = rgamma(a_par,T(1),engine);
-    const T Y = rgamma(b_par,T(1),engine);
-    
-    return X / (X + Y);
+
+    const rbeta_pars pars(static_cast<double>(a_par),static_cast<double>(b_par));
+
+    double num_val, den_val;
+    rbeta_draw_ratio(pars,engine,num_val,den_val);
+
+    return static_cast<T>(num_val / (num_val + den_val));
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_inline
 TC
-rbeta_type_check(const T1 a_par, const T2 b_par, rand_engine_t& engine)
+rbeta_type_check(const T1 a_par, const T2 b_par, rngT& engine)
 {
     return rbeta_compute(static_cast<TC>(a_par),static_cast<TC>(b_par),engine);
 }
@@ -71,10 +170,10 @@ rbeta_type_check(const T1 a_par, const T2 b_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2> 
-rbeta(const T1 a_par, const T2 b_par, rand_engine_t& engine)
+rbeta(const T1 a_par, const T2 b_par, rngT& engine)
 {
     return internal::rbeta_type_check(a_par,b_par,engine);
 }
@@ -103,6 +202,30 @@ rbeta(const T1 a_par, const T2 b_par, const ullint_t seed_val)
     return rbeta(a_par,b_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Beta distribution
+ *
+ * @param a_par a real-valued shape parameter.
+ * @param b_par a real-valued shape parameter.
+ *
+ * @return a pseudo-random draw from the Beta distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rbeta(3.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2> 
+rbeta(const T1 a_par, const T2 b_par)
+{
+    return rbeta(a_par,b_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -110,12 +233,51 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk fill: the sanity check and the per-parameter constants are computed once for all draws
+
+template<typename T1, typename T2, typename rngT, typename rT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+void
+rbeta_fill(const T1 a_par, const T2 b_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC a_par_c = static_cast<TC>(a_par);
+    const TC b_par_c = static_cast<TC>(b_par);
+
+    if (!beta_sanity_check(a_par_c,b_par_c) || rbeta_is_limit_case(a_par_c,b_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(rbeta_compute(a_par_c,b_par_c,engine));
+        }
+
+        return;
+    }
+
+    const rbeta_pars pars(static_cast<double>(a_par_c),static_cast<double>(b_par_c));
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        double num_val, den_val;
+        rbeta_draw_ratio(pars,engine,num_val,den_val);
+
+        vals_out[j] = static_cast<rT>(static_cast<TC>(num_val / (num_val + den_val)));
+    }
+}
+
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-rbeta_vec(const T1 a_par, const T2 b_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rbeta_vec(const T1 a_par, const T2 b_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rbeta_fill,vals_out,num_elem,seed_val,a_par,b_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+rbeta_vec(const T1 a_par, const T2 b_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rbeta,vals_out,num_elem,a_par,b_par);
+    rbeta_fill(a_par,b_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -123,9 +285,17 @@ rbeta_vec(const T1 a_par, const T2 b_par, rT* __stats_pointer_settings__ vals_ou
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-rbeta_mat_check(std::vector<eT>& X, const T1 a_par, const T2 b_par)
+rbeta_mat_check(std::vector<eT>& X, const T1 a_par, const T2 b_par, const ullint_t seed_val)
+{
+    STDVEC_RAND_DIST_FN(rbeta,a_par,b_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rbeta_mat_check(std::vector<eT>& X, const T1 a_par, const T2 b_par, rngT& engine)
 {
-    STDVEC_RAND_DIST_FN(rbeta,a_par,b_par);
+    STDVEC_RAND_DIST_FN(rbeta,a_par,b_par,engine);
 }
 #endif
 
@@ -133,9 +303,17 @@ rbeta_mat_check(std::vector<eT>& X, const T1 a_par, const T2 b_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-rbeta_mat_check(mT& X, const T1 a_par, const T2 b_par)
+rbeta_mat_check(mT& X, const T1 a_par, const T2 b_par, const ullint_t seed_val)
 {
-    MAIN_MAT_RAND_DIST_FN(rbeta,a_par,b_par);
+    MAIN_MAT_RAND_DIST_FN(rbeta,a_par,b_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rbeta_mat_check(mT& X, const T1 a_par, const T2 b_par, rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rbeta,a_par,b_par,engine);
 }
 #endif
 
@@ -148,6 +326,7 @@ rbeta_mat_check(mT& X, const T1 a_par, const T2 b_par)
  * @param k the number of output columns
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Beta distribution.
  *
@@ -163,6 +342,8 @@ rbeta_mat_check(mT& X, const T1 a_par, const T2 b_par)
  * stats::rbeta<Eigen::MatrixXd>(5,4,3.0,2.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -170,8 +351,47 @@ rbeta_mat_check(mT& X, const T1 a_par, const T2 b_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par)
+rbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rbeta_mat_check,a_par,b_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Beta distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param a_par a real-valued shape parameter.
+ * @param b_par a real-valued shape parameter.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Beta distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rbeta<std::vector<double>>(5,4,3.0,2.0,engine);
+ * // Armadillo matrix
+ * stats::rbeta<arma::mat>(5,4,3.0,2.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rbeta<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,3.0,2.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rbeta<Eigen::MatrixXd>(5,4,3.0,2.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rbeta(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rbeta_mat_check,a_par,b_par);
+    GEN_MAT_RAND_FN(rbeta_mat_check,a_par,b_par,engine);
 }
 #endif
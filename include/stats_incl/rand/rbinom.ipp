@@ -25,6 +25,224 @@
 //
 // scalar output
 
+namespace internal
+{
+
+// inversion by sequential search; expected cost O(n*p), used when n*p is small
+
+template<typename rngT>
+statslib_inline
+llint_t
+rbinom_inversion(const llint_t n_trials_par, const double prob_par, rngT& engine)
+{
+    const double q = 1.0 - prob_par;
+    const double q_n = std::exp(n_trials_par * std::log(q));
+    const double n_p = n_trials_par * prob_par;
+    const double bound = std::min(static_cast<double>(n_trials_par), n_p + 10.0*std::sqrt(n_p*q + 1.0));
+
+    llint_t x = 0;
+    double p_x = q_n;
+    double u = rand_unif53(engine);
+
+    while (u > p_x)
+    {
+        ++x;
+
+        if (x > bound) {
+            // restart on the (rare) numerical overrun
+            x = 0;
+            p_x = q_n;
+            u = rand_unif53(engine);
+        } else {
+            u -= p_x;
+            p_x = ((n_trials_par - x + 1) * prob_par * p_x) / (x * q);
+        }
+    }
+
+    return x;
+}
+
+// BTPE algorithm (Kachitvichyanukul and Schmeiser, 1988): triangle, parallelogram,
+// and exponential-tail majorizing regions with squeeze acceptance; the expected
+// number of iterations is bounded independently of n
+
+template<typename rngT>
+statslib_inline
+llint_t
+rbinom_btpe(const llint_t n_trials_par, const double prob_par, rngT& engine)
+{
+    const double n = static_cast<double>(n_trials_par);
+    const double r = prob_par;
+    const double q = 1.0 - r;
+
+    const double f_m = n*r + r;
+    const llint_t m = static_cast<llint_t>(std::floor(f_m));
+
+    const double p_1 = std::floor(2.195*std::sqrt(n*r*q) - 4.6*q) + 0.5;
+    const double x_m = m + 0.5;
+    const double x_l = x_m - p_1;
+    const double x_r = x_m + p_1;
+    const double c = 0.134 + 20.5 / (15.3 + m);
+
+    double a = (f_m - x_l) / (f_m - x_l*r);
+    const double lambda_l = a * (1.0 + a/2.0);
+
+    a = (x_r - f_m) / (x_r*q);
+    const double lambda_r = a * (1.0 + a/2.0);
+
+    const double p_2 = p_1 * (1.0 + 2.0*c);
+    const double p_3 = p_2 + c / lambda_l;
+    const double p_4 = p_3 + c / lambda_r;
+
+    const double nrq = n*r*q;
+
+    llint_t y;
+
+    while (true)
+    {
+        const double u = rand_unif53(engine) * p_4;
+        double v = rand_unif53(engine);
+
+        if (u <= p_1)
+        {
+            // triangular region: immediate acceptance
+            y = static_cast<llint_t>(std::floor(x_m - p_1*v + u));
+            break;
+        }
+        else if (u <= p_2)
+        {
+            // parallelogram region
+            const double x = x_l + (u - p_1) / c;
+            v = v*c + 1.0 - std::abs(m - x + 0.5) / p_1;
+
+            if (v > 1.0) {
+                continue;
+            }
+
+            y = static_cast<llint_t>(std::floor(x));
+        }
+        else if (u <= p_3)
+        {
+            // left exponential tail
+            const double y_d = std::floor(x_l + std::log(v) / lambda_l);
+
+            if (v == 0.0 || y_d < 0.0) {
+                continue;
+            }
+
+            y = static_cast<llint_t>(y_d);
+            v = v * (u - p_2) * lambda_l;
+        }
+        else
+        {
+            // right exponential tail
+            const double y_d = std::floor(x_r - std::log(v) / lambda_r);
+
+            if (v == 0.0 || y_d > n) {
+                continue;
+            }
+
+            y = static_cast<llint_t>(y_d);
+            v = v * (u - p_3) * lambda_r;
+        }
+
+        //
+
+        const llint_t k = (y > m) ? y - m : m - y;
+
+        if (k <= 20 || k >= nrq/2.0 - 1.0)
+        {
+            // explicit evaluation of f(y)/f(m) by recursion
+
+            const double s = r / q;
+            const double a_s = s * (n + 1.0);
+
+            double f_val = 1.0;
+
+            if (m < y) {
+                for (llint_t i = m + 1; i <= y; ++i) {
+                    f_val *= (a_s / i - s);
+                }
+            } else if (m > y) {
+                for (llint_t i = y + 1; i <= m; ++i) {
+                    f_val /= (a_s / i - s);
+                }
+            }
+
+            if (v <= f_val) {
+                break;
+            }
+
+            continue;
+        }
+
+        // squeeze using upper and lower bounds on log(f(y)/f(m))
+
+        const double k_d = static_cast<double>(k);
+        const double rho = (k_d / nrq) * ((k_d * (k_d/3.0 + 0.625) + 0.16666666666666666) / nrq + 0.5);
+        const double t = - k_d*k_d / (2.0*nrq);
+        const double log_v = std::log(v);
+
+        if (log_v < t - rho) {
+            break;
+        }
+
+        if (log_v > t + rho) {
+            continue;
+        }
+
+        // final comparison using Stirling's formula
+
+        const double x_1 = y + 1.0;
+        const double f_1 = m + 1.0;
+        const double z = n + 1.0 - m;
+        const double w = n - y + 1.0;
+
+        const double x_2 = x_1*x_1, f_2 = f_1*f_1, z_2 = z*z, w_2 = w*w;
+
+        const double log_bound = x_m * std::log(f_1 / x_1) + (n - m + 0.5) * std::log(z / w) + (y - m) * std::log(w * r / (x_1 * q))
+            + (13680. - (462. - (132. - (99. - 140. / f_2) / f_2) / f_2) / f_2) / f_1 / 166320.
+            + (13680. - (462. - (132. - (99. - 140. / z_2) / z_2) / z_2) / z_2) / z / 166320.
+            + (13680. - (462. - (132. - (99. - 140. / x_2) / x_2) / x_2) / x_2) / x_1 / 166320.
+            + (13680. - (462. - (132. - (99. - 140. / w_2) / w_2) / w_2) / w_2) / w / 166320.;
+
+        if (log_v <= log_bound) {
+            break;
+        }
+    }
+
+    return y;
+}
+
+template<typename rngT>
+statslib_inline
+llint_t
+rbinom_compute(const llint_t n_trials_par, const double prob_par, rngT& engine)
+{
+    // up to 64 trials: count the successes in one word of packed Bernoulli draws, whose cost
+    // does not grow with n*p
+
+    if (n_trials_par <= llint_t(64) && n_trials_par * std::min(prob_par,1.0 - prob_par) >= 4.0)
+    {
+        const ullint_t trials_mask = (n_trials_par == llint_t(64)) ? ~ullint_t(0) : (ullint_t(1) << n_trials_par) - ullint_t(1);
+
+        return static_cast<llint_t>(popcount64(rbern_bits64(prob_par,engine) & trials_mask));
+    }
+
+    // sample with min(p,1-p) and reflect
+
+    const bool flip = prob_par > 0.5;
+    const double prob_min = flip ? 1.0 - prob_par : prob_par;
+
+    const llint_t x = ( n_trials_par * prob_min <= 30.0 ) ? \
+                        rbinom_inversion(n_trials_par,prob_min,engine) :
+                        rbinom_btpe(n_trials_par,prob_min,engine);
+
+    return flip ? n_trials_par - x : x;
+}
+
+}
+
 /**
  * @brief Random sampling function for the Binomial distribution
  *
@@ -32,7 +250,7 @@
  * @param prob_par the probability parameter, a real-valued input.
  * @param engine a random engine, passed by reference.
  *
- * @return a pseudo-random draw from the Beta distribution.
+ * @return a pseudo-random draw from the Binomial distribution.
  * 
  * Example:
  * \code{.cpp}
@@ -41,10 +259,10 @@
  * \endcode
  */
 
-template<typename T>
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 return_t<T>
-rbinom(const llint_t n_trials_par, const T prob_par, rand_engine_t& engine)
+rbinom(const llint_t n_trials_par, const T prob_par, rngT& engine)
 {
     if (!internal::binom_sanity_check(n_trials_par,prob_par)) {
         return STLIM<T>::quiet_NaN();
@@ -52,14 +270,7 @@ rbinom(const llint_t n_trials_par, const T prob_par, rand_engine_t& engine)
 
     //
 
-    return_t<T> ret = return_t<T>(0);
-
-    for (llint_t i=llint_t(0); i < n_trials_par; ++i)
-    {
-        ret += rbern(prob_par,engine);
-    }
-
-    return ret;
+    return static_cast<return_t<T>>(internal::rbinom_compute(n_trials_par,static_cast<double>(prob_par),engine));
 }
 
 /**
@@ -69,7 +280,7 @@ rbinom(const llint_t n_trials_par, const T prob_par, rand_engine_t& engine)
  * @param prob_par the probability parameter, a real-valued input.
  * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
- * @return a pseudo-random draw from the Beta distribution.
+ * @return a pseudo-random draw from the Binomial distribution.
  * 
  * Example:
  * \code{.cpp}
@@ -86,6 +297,30 @@ rbinom(const llint_t n_trials_par, const T prob_par, const ullint_t seed_val)
     return rbinom(n_trials_par,prob_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Binomial distribution
+ *
+ * @param n_trials_par the number of trials, a non-negative integral-valued input.
+ * @param prob_par the probability parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Binomial distribution.
+ * 
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rbinom(4,0.4);
+ * \endcode
+ */
+
+template<typename T>
+statslib_inline
+return_t<T>
+rbinom(const llint_t n_trials_par, const T prob_par)
+{
+    return rbinom(n_trials_par,prob_par,internal::default_engine());
+}
+
 //
 // matrix output
 
@@ -96,9 +331,17 @@ namespace internal
 template<typename T1, typename rT>
 statslib_inline
 void
-rbinom_vec(const llint_t n_trials_par, const T1 prob_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rbinom_vec(const llint_t n_trials_par, const T1 prob_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC(rbinom,vals_out,num_elem,seed_val,n_trials_par,prob_par);
+}
+
+template<typename T1, typename rngT, typename rT>
+statslib_inline
+void
+rbinom_vec(const llint_t n_trials_par, const T1 prob_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rbinom,vals_out,num_elem,n_trials_par,prob_par);
+    RAND_DIST_FN_VEC_ENGINE(rbinom,vals_out,num_elem,engine,n_trials_par,prob_par);
 }
 #endif
 
@@ -106,9 +349,17 @@ rbinom_vec(const llint_t n_trials_par, const T1 prob_par, rT* __stats_pointer_se
 template<typename eT, typename T1>
 statslib_inline
 void
-rbinom_mat_check(std::vector<eT>& X, const llint_t n_trials_par, const T1 prob_par)
+rbinom_mat_check(std::vector<eT>& X, const llint_t n_trials_par, const T1 prob_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(rbinom,n_trials_par,prob_par);
+    STDVEC_RAND_DIST_FN(rbinom,n_trials_par,prob_par,seed_val);
+}
+
+template<typename eT, typename T1, typename rngT>
+statslib_inline
+void
+rbinom_mat_check(std::vector<eT>& X, const llint_t n_trials_par, const T1 prob_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rbinom,n_trials_par,prob_par,engine);
 }
 #endif
 
@@ -116,9 +367,17 @@ rbinom_mat_check(std::vector<eT>& X, const llint_t n_trials_par, const T1 prob_p
 template<typename mT, typename T1>
 statslib_inline
 void
-rbinom_mat_check(mT& X, const llint_t n_trials_par, const T1 prob_par)
+rbinom_mat_check(mT& X, const llint_t n_trials_par, const T1 prob_par, const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rbinom,n_trials_par,prob_par,seed_val);
+}
+
+template<typename mT, typename T1, typename rngT>
+statslib_inline
+void
+rbinom_mat_check(mT& X, const llint_t n_trials_par, const T1 prob_par, rngT& engine)
 {
-    MAIN_MAT_RAND_DIST_FN(rbinom,n_trials_par,prob_par);
+    MAIN_MAT_RAND_DIST_FN(rbinom,n_trials_par,prob_par,engine);
 }
 #endif
 
@@ -131,6 +390,7 @@ rbinom_mat_check(mT& X, const llint_t n_trials_par, const T1 prob_par)
  * @param k the number of output columns
  * @param n_trials_par the number of trials, a non-negative integral-valued input.
  * @param prob_par the probability parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Binomial distribution.
  *
@@ -146,6 +406,8 @@ rbinom_mat_check(mT& X, const llint_t n_trials_par, const T1 prob_par)
  * stats::rbinom<Eigen::MatrixXd>(5,4,5,0.7);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -153,8 +415,47 @@ rbinom_mat_check(mT& X, const llint_t n_trials_par, const T1 prob_par)
 template<typename mT, typename T1>
 statslib_inline
 mT
-rbinom(const ullint_t n, const ullint_t k, const llint_t n_trials_par, const T1 prob_par)
+rbinom(const ullint_t n, const ullint_t k, const llint_t n_trials_par, const T1 prob_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rbinom_mat_check,n_trials_par,prob_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Binomial distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param n_trials_par the number of trials, a non-negative integral-valued input.
+ * @param prob_par the probability parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Binomial distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rbinom<std::vector<double>>(5,4,5,0.7,engine);
+ * // Armadillo matrix
+ * stats::rbinom<arma::mat>(5,4,5,0.7,engine);
+ * // Blaze dynamic matrix
+ * stats::rbinom<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,5,0.7,engine);
+ * // Eigen dynamic matrix
+ * stats::rbinom<Eigen::MatrixXd>(5,4,5,0.7,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rbinom(const ullint_t n, const ullint_t k, const llint_t n_trials_par, const T1 prob_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rbinom_mat_check,n_trials_par,prob_par);
+    GEN_MAT_RAND_FN(rbinom_mat_check,n_trials_par,prob_par,engine);
 }
 #endif
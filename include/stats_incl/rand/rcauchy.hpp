@@ -28,15 +28,20 @@
 //
 // scalar output
 
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+common_return_t<T1,T2>
+rcauchy(const T1 mu_par, const T2 sigma_par, rngT& engine);
+
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rcauchy(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rcauchy(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val);
 
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rcauchy(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rcauchy(const T1 mu_par, const T2 sigma_par);
 
 //
 // vector/matrix output
@@ -45,7 +50,14 @@ rcauchy(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::rand
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par);
+rcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par,
+        const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par,
+        rngT& engine);
 #endif
 
 //
@@ -28,21 +28,31 @@
 namespace internal
 {
 
+// map a draw from (0,1) to a Cauchy draw via the quantile function
+
 template<typename T>
 statslib_inline
 T
-rcauchy_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
+rcauchy_unif_transform(const T u, const T mu_par, const T sigma_par)
+{
+    return( mu_par + sigma_par*std::tan(T(GCEM_PI)*(u - T(0.5))) );
+}
+
+template<typename T, typename rngT>
+statslib_inline
+T
+rcauchy_compute(const T mu_par, const T sigma_par, rngT& engine)
 {
     return( !cauchy_sanity_check(mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qcauchy(runif(T(0),T(1),engine),mu_par,sigma_par) );
+            rcauchy_unif_transform(rand_unif_open<T>(engine),mu_par,sigma_par) );
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_inline
 TC
-rcauchy_type_check(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
+rcauchy_type_check(const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
     return rcauchy_compute(static_cast<TC>(mu_par),static_cast<TC>(sigma_par),engine);
 }
@@ -65,10 +75,10 @@ rcauchy_type_check(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2>
-rcauchy(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
+rcauchy(const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
     return internal::rcauchy_type_check(mu_par,sigma_par,engine);
 }
@@ -97,6 +107,30 @@ rcauchy(const T1 mu_par, const T2 sigma_par, ullint_t seed_val)
     return rcauchy(mu_par,sigma_par,engine);
 }
 
+/**
+ * Random sampling function for the Cauchy distribution
+ *
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Cauchy distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rcauchy(1.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rcauchy(const T1 mu_par, const T2 sigma_par)
+{
+    return rcauchy(mu_par,sigma_par,internal::default_engine());
+}
+
 //
 // matrix output
 
@@ -104,12 +138,57 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+// bulk fill: the sanity check is done once, and uniforms are generated and transformed in batches
+
+template<typename T1, typename T2, typename rngT, typename rT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+void
+rcauchy_fill(const T1 mu_par, const T2 sigma_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC mu_par_c = static_cast<TC>(mu_par);
+    const TC sigma_par_c = static_cast<TC>(sigma_par);
+
+    if (!cauchy_sanity_check(mu_par_c,sigma_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    const double mu_par_d = static_cast<double>(mu_par_c);
+    const double sigma_par_d = static_cast<double>(sigma_par_c);
+
+    rand_unif_batch_fill<TC>(engine,vals_out,num_elem,
+        [=](double* vals, const ullint_t n_vals)
+        {
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] -= 0.5;
+            }
+
+            batch_tanpi(vals,n_vals);
+
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = mu_par_d + sigma_par_d*vals[j];
+            }
+        });
+}
+
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-rcauchy_vec(const T1 mu_par, const T2 sigma_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rcauchy_vec(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rcauchy_fill,vals_out,num_elem,seed_val,mu_par,sigma_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+rcauchy_vec(const T1 mu_par, const T2 sigma_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rcauchy,vals_out,num_elem,mu_par,sigma_par);
+    rcauchy_fill(mu_par,sigma_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -117,9 +196,17 @@ rcauchy_vec(const T1 mu_par, const T2 sigma_par, rT* __stats_pointer_settings__
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-rcauchy_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par)
+rcauchy_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(rcauchy,mu_par,sigma_par);
+    STDVEC_RAND_DIST_FN(rcauchy,mu_par,sigma_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rcauchy_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rcauchy,mu_par,sigma_par,engine);
 }
 #endif
 
@@ -127,9 +214,17 @@ rcauchy_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-rcauchy_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
+rcauchy_mat_check(mT& X, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
 {
-    MAIN_MAT_RAND_DIST_FN(rcauchy,mu_par,sigma_par);
+    MAIN_MAT_RAND_DIST_FN(rcauchy,mu_par,sigma_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rcauchy_mat_check(mT& X, const T1 mu_par, const T2 sigma_par, rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rcauchy,mu_par,sigma_par,engine);
 }
 #endif
 
@@ -142,6 +237,7 @@ rcauchy_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
  * @param k the number of output columns
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Cauchy distribution.
  *
@@ -157,6 +253,8 @@ rcauchy_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
  * stats::rcauchy<Eigen::MatrixXd>(5,4,1.0,2.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element types \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -164,8 +262,47 @@ rcauchy_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par)
+rcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rcauchy_mat_check,mu_par,sigma_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Cauchy distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Cauchy distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rcauchy<std::vector<double>>(5,4,1.0,2.0,engine);
+ * // Armadillo matrix
+ * stats::rcauchy<arma::mat>(5,4,1.0,2.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rcauchy<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,1.0,2.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rcauchy<Eigen::MatrixXd>(5,4,1.0,2.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element types \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rcauchy(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rcauchy_mat_check,mu_par,sigma_par);
+    GEN_MAT_RAND_FN(rcauchy_mat_check,mu_par,sigma_par,engine);
 }
 #endif
@@ -28,15 +28,20 @@
 //
 // scalar output
 
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+return_t<T>
+rchisq(const T dof_par, rngT& engine);
+
 template<typename T>
 statslib_inline
 return_t<T>
-rchisq(const T dof_par, rand_engine_t& engine);
+rchisq(const T dof_par, const ullint_t seed_val);
 
 template<typename T>
 statslib_inline
 return_t<T>
-rchisq(const T dof_par, const ullint_t seed_val = std::random_device{}());
+rchisq(const T dof_par);
 
 //
 // vector/matrix output
@@ -45,7 +50,14 @@ rchisq(const T dof_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rchisq(const ullint_t n, const ullint_t k, const T1 dof_par);
+rchisq(const ullint_t n, const ullint_t k, const T1 dof_par,
+       const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rchisq(const ullint_t n, const ullint_t k, const T1 dof_par,
+       rngT& engine);
 #endif
 
 //
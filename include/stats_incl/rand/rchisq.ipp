@@ -28,10 +28,10 @@
 namespace internal
 {
 
-template<typename T>
+template<typename T, typename rngT>
 statslib_inline
 T
-rchisq_compute(const T dof_par, rand_engine_t& engine)
+rchisq_compute(const T dof_par, rngT& engine)
 {
     return( !chisq_sanity_check(dof_par) ? \
                 STLIM<T>::quiet_NaN() :
@@ -56,10 +56,10 @@ rchisq_compute(const T dof_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T>
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 return_t<T>
-rchisq(const T dof_par, rand_engine_t& engine)
+rchisq(const T dof_par, rngT& engine)
 {
     return internal::rchisq_compute(static_cast<return_t<T>>(dof_par),engine);
 }
@@ -87,6 +87,29 @@ rchisq(const T dof_par, const ullint_t seed_val)
     return rchisq(dof_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Chi-squared distribution
+ *
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Chi-squared distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rchisq(4);
+ * \endcode
+ */
+
+template<typename T>
+statslib_inline
+return_t<T>
+rchisq(const T dof_par)
+{
+    return rchisq(dof_par,internal::default_engine());
+}
+
 //
 // matrix output
 
@@ -97,9 +120,17 @@ namespace internal
 template<typename T1, typename rT>
 statslib_inline
 void
-rchisq_vec(const T1 dof_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rchisq_vec(const T1 dof_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC(rchisq,vals_out,num_elem,seed_val,dof_par);
+}
+
+template<typename T1, typename rngT, typename rT>
+statslib_inline
+void
+rchisq_vec(const T1 dof_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rchisq,vals_out,num_elem,dof_par);
+    RAND_DIST_FN_VEC_ENGINE(rchisq,vals_out,num_elem,engine,dof_par);
 }
 #endif
 
@@ -107,9 +138,17 @@ rchisq_vec(const T1 dof_par, rT* __stats_pointer_settings__ vals_out, const ulli
 template<typename eT, typename T1>
 statslib_inline
 void
-rchisq_mat_check(std::vector<eT>& X, const T1 dof_par)
+rchisq_mat_check(std::vector<eT>& X, const T1 dof_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(rchisq,dof_par);
+    STDVEC_RAND_DIST_FN(rchisq,dof_par,seed_val);
+}
+
+template<typename eT, typename T1, typename rngT>
+statslib_inline
+void
+rchisq_mat_check(std::vector<eT>& X, const T1 dof_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rchisq,dof_par,engine);
 }
 #endif
 
@@ -117,9 +156,17 @@ rchisq_mat_check(std::vector<eT>& X, const T1 dof_par)
 template<typename mT, typename T1>
 statslib_inline
 void
-rchisq_mat_check(mT& X, const T1 dof_par)
+rchisq_mat_check(mT& X, const T1 dof_par, const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rchisq,dof_par,seed_val);
+}
+
+template<typename mT, typename T1, typename rngT>
+statslib_inline
+void
+rchisq_mat_check(mT& X, const T1 dof_par, rngT& engine)
 {
-    MAIN_MAT_RAND_DIST_FN(rchisq,dof_par);
+    MAIN_MAT_RAND_DIST_FN(rchisq,dof_par,engine);
 }
 #endif
 
@@ -131,6 +178,7 @@ rchisq_mat_check(mT& X, const T1 dof_par)
  * @param n the number of output rows
  * @param k the number of output columns
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Chi-squared distribution.
  *
@@ -146,6 +194,8 @@ rchisq_mat_check(mT& X, const T1 dof_par)
  * stats::rchisq<Eigen::MatrixXd>(5,4,4);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -153,8 +203,46 @@ rchisq_mat_check(mT& X, const T1 dof_par)
 template<typename mT, typename T1>
 statslib_inline
 mT
-rchisq(const ullint_t n, const ullint_t k, const T1 dof_par)
+rchisq(const ullint_t n, const ullint_t k, const T1 dof_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rchisq_mat_check,dof_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Chi-squared distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Chi-squared distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rchisq<std::vector<double>>(5,4,4,engine);
+ * // Armadillo matrix
+ * stats::rchisq<arma::mat>(5,4,4,engine);
+ * // Blaze dynamic matrix
+ * stats::rchisq<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,4,engine);
+ * // Eigen dynamic matrix
+ * stats::rchisq<Eigen::MatrixXd>(5,4,4,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rchisq(const ullint_t n, const ullint_t k, const T1 dof_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rchisq_mat_check,dof_par);
+    GEN_MAT_RAND_FN(rchisq_mat_check,dof_par,engine);
 }
 #endif
@@ -28,15 +28,26 @@
 namespace internal
 {
 
+// map a draw from (0,1) to an Exponential draw; -log(u) is the quantile function at 1 - u,
+// which has the same distribution
+
 template<typename T>
 statslib_inline
 T
-rexp_compute(const T rate_par, rand_engine_t& engine)
+rexp_unif_transform(const T u, const T rate_par)
+{
+    return( - std::log(u) / rate_par );
+}
+
+template<typename T, typename rngT>
+statslib_inline
+T
+rexp_compute(const T rate_par, rngT& engine)
 {
     return( !exp_sanity_check(rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qexp(runif(T(0),T(1),engine),rate_par) );
+            rexp_unif_transform(rand_unif_open<T>(engine),rate_par) );
 }
 
 }
@@ -56,10 +67,10 @@ rexp_compute(const T rate_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T>
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 return_t<T>
-rexp(const T rate_par, rand_engine_t& engine)
+rexp(const T rate_par, rngT& engine)
 {
     return internal::rexp_compute(static_cast<return_t<T>>(rate_par),engine);
 }
@@ -87,6 +98,29 @@ rexp(const T rate_par, const ullint_t seed_val)
     return rexp(rate_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Exponential distribution
+ *
+ * @param rate_par the rate parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Exponential distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rexp(4);
+ * \endcode
+ */
+
+template<typename T>
+statslib_inline
+return_t<T>
+rexp(const T rate_par)
+{
+    return rexp(rate_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -94,12 +128,51 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+// bulk fill: the sanity check is done once, and uniforms are generated and transformed in batches
+
+template<typename T1, typename rngT, typename rT, typename TC = return_t<T1>>
+statslib_inline
+void
+rexp_fill(const T1 rate_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC rate_par_c = static_cast<TC>(rate_par);
+
+    if (!exp_sanity_check(rate_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    const double rate_par_d = static_cast<double>(rate_par_c);
+
+    rand_unif_batch_fill<TC>(engine,vals_out,num_elem,
+        [=](double* vals, const ullint_t n_vals)
+        {
+            batch_log(vals,n_vals);
+
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = - vals[j] / rate_par_d;
+            }
+        });
+}
+
 template<typename T1, typename rT>
 statslib_inline
 void
-rexp_vec(const T1 rate_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rexp_vec(const T1 rate_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rexp_fill,vals_out,num_elem,seed_val,rate_par);
+}
+
+template<typename T1, typename rngT, typename rT>
+statslib_inline
+void
+rexp_vec(const T1 rate_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rexp,vals_out,num_elem,rate_par);
+    rexp_fill(rate_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -107,9 +180,17 @@ rexp_vec(const T1 rate_par, rT* __stats_pointer_settings__ vals_out, const ullin
 template<typename eT, typename T1>
 statslib_inline
 void
-rexp_mat_check(std::vector<eT>& X, const T1 dof_par)
+rexp_mat_check(std::vector<eT>& X, const T1 dof_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(rexp,dof_par);
+    STDVEC_RAND_DIST_FN(rexp,dof_par,seed_val);
+}
+
+template<typename eT, typename T1, typename rngT>
+statslib_inline
+void
+rexp_mat_check(std::vector<eT>& X, const T1 dof_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rexp,dof_par,engine);
 }
 #endif
 
@@ -117,9 +198,17 @@ rexp_mat_check(std::vector<eT>& X, const T1 dof_par)
 template<typename mT, typename T1>
 statslib_inline
 void
-rexp_mat_check(mT& X, const T1 dof_par)
+rexp_mat_check(mT& X, const T1 dof_par, const ullint_t seed_val)
 {
-    MAIN_MAT_RAND_DIST_FN(rexp,dof_par);
+    MAIN_MAT_RAND_DIST_FN(rexp,dof_par,seed_val);
+}
+
+template<typename mT, typename T1, typename rngT>
+statslib_inline
+void
+rexp_mat_check(mT& X, const T1 dof_par, rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rexp,dof_par,engine);
 }
 #endif
 
@@ -131,6 +220,7 @@ rexp_mat_check(mT& X, const T1 dof_par)
  * @param n the number of output rows
  * @param k the number of output columns
  * @param rate_par the rate parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Exponential distribution.
  *
@@ -146,6 +236,8 @@ rexp_mat_check(mT& X, const T1 dof_par)
  * stats::rexp<Eigen::MatrixXd>(5,4,4);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -153,8 +245,46 @@ rexp_mat_check(mT& X, const T1 dof_par)
 template<typename mT, typename T1>
 statslib_inline
 mT
-rexp(const ullint_t n, const ullint_t k, const T1 rate_par)
+rexp(const ullint_t n, const ullint_t k, const T1 rate_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rexp_mat_check,rate_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Exponential distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param rate_par the rate parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Exponential distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rexp<std::vector<double>>(5,4,4,engine);
+ * // Armadillo matrix
+ * stats::rexp<arma::mat>(5,4,4,engine);
+ * // Blaze dynamic matrix
+ * stats::rexp<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,4,engine);
+ * // Eigen dynamic matrix
+ * stats::rexp<Eigen::MatrixXd>(5,4,4,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rexp(const ullint_t n, const ullint_t k, const T1 rate_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rexp_mat_check,rate_par);
+    GEN_MAT_RAND_FN(rexp_mat_check,rate_par,engine);
 }
 #endif
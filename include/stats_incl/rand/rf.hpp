@@ -28,15 +28,20 @@
 //
 // scalar output
 
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+common_return_t<T1,T2>
+rf(const T1 df1_par, const T2 df2_par, rngT& engine);
+
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rf(const T1 df1_par, const T2 df2_par, rand_engine_t& engine);
+rf(const T1 df1_par, const T2 df2_par, const ullint_t seed_val);
 
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rf(const T1 df1_par, const T2 df2_par, const ullint_t seed_val = std::random_device{}());
+rf(const T1 df1_par, const T2 df2_par);
 
 //
 // vector/matrix output
@@ -45,7 +50,14 @@ rf(const T1 df1_par, const T2 df2_par, const ullint_t seed_val = std::random_dev
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par);
+rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par,
+   const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par,
+   rngT& engine);
 #endif
 
 //
@@ -28,27 +28,39 @@
 namespace internal
 {
 
-template<typename T>
+template<typename T, typename rngT>
 statslib_inline
 T
-rf_compute(const T df1_par, const T df2_par, rand_engine_t& engine)
+rf_compute(const T df1_par, const T df2_par, rngT& engine)
 {
     if (!f_sanity_check(df1_par,df2_par)) {
         return STLIM<T>::quiet_NaN();
     }
 
     //
-    
-    const T X = rchisq(df1_par,engine);
-    const T Y = rchisq(df2_par,engine);
-    
-    return( (df2_par / df1_par) * X / Y );
+
+    if (GCINT::any_inf(df1_par,df2_par))
+    {
+        const T X = rchisq(df1_par,engine);
+        const T Y = rchisq(df2_par,engine);
+
+        return( (df2_par / df1_par) * X / Y );
+    }
+
+    // X/(1-X) for X ~ Beta(df1/2, df2/2), using a single direct Beta draw
+
+    const rbeta_pars pars(static_cast<double>(df1_par) / 2.0, static_cast<double>(df2_par) / 2.0);
+
+    double num_val, den_val;
+    rbeta_draw_ratio(pars,engine,num_val,den_val);
+
+    return( (df2_par / df1_par) * static_cast<T>(num_val / den_val) );
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_inline
 TC
-rf_type_check(const T1 df1_par, const T2 df2_par, rand_engine_t& engine)
+rf_type_check(const T1 df1_par, const T2 df2_par, rngT& engine)
 {
     return rf_compute(static_cast<TC>(df1_par),static_cast<TC>(df2_par),engine);
 }
@@ -71,10 +83,10 @@ rf_type_check(const T1 df1_par, const T2 df2_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2>
-rf(const T1 df1_par, const T2 df2_par, rand_engine_t& engine)
+rf(const T1 df1_par, const T2 df2_par, rngT& engine)
 {
     return internal::rf_type_check(df1_par,df2_par,engine);
 }
@@ -103,6 +115,30 @@ rf(const T1 df1_par, const T2 df2_par, ullint_t seed_val)
     return rf(df1_par,df2_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the F-distribution
+ *
+ * @param df1_par a degrees of freedom parameter, a real-valued input.
+ * @param df2_par a degrees of freedom parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the F-distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rf(3.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rf(const T1 df1_par, const T2 df2_par)
+{
+    return rf(df1_par,df2_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -113,9 +149,17 @@ namespace internal
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-rf_vec(const T1 df1_par, const T2 df2_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rf_vec(const T1 df1_par, const T2 df2_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rf,vals_out,num_elem,df1_par,df2_par);
+    RAND_DIST_FN_VEC(rf,vals_out,num_elem,seed_val,df1_par,df2_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+rf_vec(const T1 df1_par, const T2 df2_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_ENGINE(rf,vals_out,num_elem,engine,df1_par,df2_par);
 }
 #endif
 
@@ -123,9 +167,17 @@ rf_vec(const T1 df1_par, const T2 df2_par, rT* __stats_pointer_settings__ vals_o
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-rf_mat_check(std::vector<eT>& X, const T1 df1_par, const T2 df2_par)
+rf_mat_check(std::vector<eT>& X, const T1 df1_par, const T2 df2_par, const ullint_t seed_val)
+{
+    STDVEC_RAND_DIST_FN(rf,df1_par,df2_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rf_mat_check(std::vector<eT>& X, const T1 df1_par, const T2 df2_par, rngT& engine)
 {
-    STDVEC_RAND_DIST_FN(rf,df1_par,df2_par);
+    STDVEC_RAND_DIST_FN(rf,df1_par,df2_par,engine);
 }
 #endif
 
@@ -133,9 +185,17 @@ rf_mat_check(std::vector<eT>& X, const T1 df1_par, const T2 df2_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-rf_mat_check(mT& X, const T1 df1_par, const T2 df2_par)
+rf_mat_check(mT& X, const T1 df1_par, const T2 df2_par, const ullint_t seed_val)
 {
-    MAIN_MAT_RAND_DIST_FN(rf,df1_par,df2_par);
+    MAIN_MAT_RAND_DIST_FN(rf,df1_par,df2_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rf_mat_check(mT& X, const T1 df1_par, const T2 df2_par, rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rf,df1_par,df2_par,engine);
 }
 #endif
 
@@ -148,6 +208,7 @@ rf_mat_check(mT& X, const T1 df1_par, const T2 df2_par)
  * @param k the number of output columns
  * @param df1_par a degrees of freedom parameter, a real-valued input.
  * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the F-distribution.
  *
@@ -163,6 +224,8 @@ rf_mat_check(mT& X, const T1 df1_par, const T2 df2_par)
  * stats::rf<Eigen::MatrixXd>(5,4,3.0,2.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -170,8 +233,47 @@ rf_mat_check(mT& X, const T1 df1_par, const T2 df2_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par)
+rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rf_mat_check,df1_par,df2_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the F-distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param df1_par a degrees of freedom parameter, a real-valued input.
+ * @param df2_par a degrees of freedom parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the F-distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rf<std::vector<double>>(5,4,3.0,2.0,engine);
+ * // Armadillo matrix
+ * stats::rf<arma::mat>(5,4,3.0,2.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rf<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,3.0,2.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rf<Eigen::MatrixXd>(5,4,3.0,2.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rf(const ullint_t n, const ullint_t k, const T1 df1_par, const T2 df2_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rf_mat_check,df1_par,df2_par);
+    GEN_MAT_RAND_FN(rf_mat_check,df1_par,df2_par,engine);
 }
 #endif
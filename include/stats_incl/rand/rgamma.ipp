@@ -29,61 +29,98 @@
 namespace internal
 {
 
-template<typename T>
-statslib_inline
-T
-rgamma_compute(const T shape_par, const T scale_par, rand_engine_t& engine)
+// constants of the Marsaglia-Tsang method; these depend only on the shape parameter.
+// For shape < 1, a draw X ~ Gamma(shape+1) is boosted to X * U^(1/shape), computed in log-space
+
+struct rgamma_mt_pars
 {
-    if (!gamma_sanity_check(shape_par,scale_par)) {
-        return STLIM<T>::quiet_NaN();
-    }
+    double d;
+    double c;
+    double inv_shape;
+    bool boost;
 
-    //
+    explicit rgamma_mt_pars(const double shape_par)
+    {
+        boost = (shape_par < 1.0);
 
-    T ret = 0;
+        d = (boost ? shape_par + 1.0 : shape_par) - 1.0/3.0;
+        c = 1.0 / std::sqrt(9.0*d);
+        inv_shape = 1.0 / shape_par;
+    }
+};
 
-    if (shape_par > T(1))
-    {
-        const T d = shape_par - T(1)/T(3);
-        const T c = (T(1) / T(3)) / std::sqrt(d);
-        T V = 1;
+// accept or reject a candidate (z, u); returns the gamma variate (before boosting and scaling), or 0 if rejected
 
-        bool keep_running = true;
+statslib_inline
+double
+rgamma_mt_accept(const rgamma_mt_pars& pars, const double z, const double u)
+{
+    const double v_cbrt = 1.0 + pars.c*z;
+    const double v = v_cbrt*v_cbrt*v_cbrt;
+    const double z_2 = z*z;
 
-        while (keep_running)
-        {
-            T Z = rnorm(T(0),T(1),engine);
+    return( v_cbrt <= 0.0 ? \
+                0.0 :
+            // squeeze
+            u < 1.0 - 0.0331*z_2*z_2 ? \
+                pars.d * v :
+            //
+            std::log(u) < 0.5*z_2 + pars.d*(1.0 - v + std::log(v)) ? \
+                pars.d * v :
+            //
+                0.0 );
+}
+
+template<typename rngT>
+statslib_inline
+double
+rgamma_mt_boost(const rgamma_mt_pars& pars, const double x, rngT& engine)
+{
+    return( pars.boost ? \
+                x * std::exp(std::log(rand_unif53(engine)) * pars.inv_shape) :
+                x );
+}
 
-            if (Z > -T(1)/c)
-            {
-                V = std::pow(T(1) + c*Z,3);
-                T U = runif(T(0),T(1),engine);
+template<typename rngT>
+statslib_inline
+double
+rgamma_mt_draw(const rgamma_mt_pars& pars, rngT& engine)
+{
+    const rnorm_zig_tables& zig_tables = rnorm_zig_get_tables();
 
-                T check_2 = T(0.5)*Z*Z + d*(T(1) - V + std::log(V));
+    double x = 0.0;
 
-                if (std::log(U) < check_2) {
-                    keep_running = false;
-                }
-            }
-        }
+    while (x == 0.0)
+    {
+        const double z = rnorm_zig_draw(zig_tables,engine);
+        const double u = rand_unif53(engine);
 
-        ret = d * V * scale_par;
+        x = rgamma_mt_accept(pars,z,u);
     }
-    else
-    {
-        const T U = runif(T(0),T(1),engine);
-        ret = rgamma(T(1) + shape_par, scale_par,engine) * std::pow(U,T(1)/shape_par);
+
+    return rgamma_mt_boost(pars,x,engine);
+}
+
+template<typename T, typename rngT>
+statslib_inline
+T
+rgamma_compute(const T shape_par, const T scale_par, rngT& engine)
+{
+    if (!gamma_sanity_check(shape_par,scale_par)) {
+        return STLIM<T>::quiet_NaN();
     }
 
     //
 
-    return ret;
+    const rgamma_mt_pars pars(static_cast<double>(shape_par));
+
+    return static_cast<T>(rgamma_mt_draw(pars,engine)) * scale_par;
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-rgamma_type_check(const T1 shape_par, const T2 scale_par, rand_engine_t& engine)
+rgamma_type_check(const T1 shape_par, const T2 scale_par, rngT& engine)
 noexcept
 {
     return rgamma_compute(static_cast<TC>(shape_par),static_cast<TC>(scale_par),engine);
@@ -107,10 +144,10 @@ noexcept
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2>
-rgamma(const T1 shape_par, const T2 scale_par, rand_engine_t& engine)
+rgamma(const T1 shape_par, const T2 scale_par, rngT& engine)
 {
     return internal::rgamma_type_check(shape_par,scale_par,engine);
 }
@@ -139,6 +176,30 @@ rgamma(const T1 shape_par, const T2 scale_par, ullint_t seed_val)
     return rgamma(shape_par,scale_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Gamma distribution
+ *
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Gamma distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rgamma(3.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rgamma(const T1 shape_par, const T2 scale_par)
+{
+    return rgamma(shape_par,scale_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -146,12 +207,80 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// batch generator: the sanity check and Marsaglia-Tsang constants are computed once;
+// rejection candidates are drawn in blocks of STATS_RGAMMA_BATCH_SIZE, tested in a
+// loop free of engine calls, and the accepted values are compacted into the output
+
+template<typename T1, typename T2, typename rngT, typename rT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+void
+rgamma_fill(const T1 shape_par, const T2 scale_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC shape_par_c = static_cast<TC>(shape_par);
+    const TC scale_par_c = static_cast<TC>(scale_par);
+
+    if (!gamma_sanity_check(shape_par_c,scale_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    //
+
+    const rgamma_mt_pars pars(static_cast<double>(shape_par_c));
+    const rnorm_zig_tables& zig_tables = rnorm_zig_get_tables();
+
+    double z_cand[STATS_RGAMMA_BATCH_SIZE];
+    double u_cand[STATS_RGAMMA_BATCH_SIZE];
+    double x_cand[STATS_RGAMMA_BATCH_SIZE];
+
+    ullint_t n_filled = 0;
+
+    while (n_filled < num_elem)
+    {
+        // the acceptance rate is above 0.95 for all shapes; draw slightly more candidates than needed
+
+        const ullint_t n_left = num_elem - n_filled;
+        const ullint_t n_cand = std::min(ullint_t(STATS_RGAMMA_BATCH_SIZE), n_left + n_left / ullint_t(16) + ullint_t(1));
+
+        for (ullint_t i=ullint_t(0); i < n_cand; ++i)
+        {
+            z_cand[i] = rnorm_zig_draw(zig_tables,engine);
+            u_cand[i] = rand_unif53(engine);
+        }
+
+        for (ullint_t i=ullint_t(0); i < n_cand; ++i)
+        {
+            x_cand[i] = rgamma_mt_accept(pars,z_cand[i],u_cand[i]);
+        }
+
+        for (ullint_t i=ullint_t(0); i < n_cand && n_filled < num_elem; ++i)
+        {
+            if (x_cand[i] > 0.0) {
+                vals_out[n_filled++] = static_cast<rT>(static_cast<TC>(rgamma_mt_boost(pars,x_cand[i],engine)) * scale_par_c);
+            }
+        }
+    }
+}
+
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-rgamma_vec(const T1 shape_par, const T2 scale_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rgamma_vec(const T1 shape_par, const T2 scale_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rgamma_fill,vals_out,num_elem,seed_val,shape_par,scale_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+rgamma_vec(const T1 shape_par, const T2 scale_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rgamma,vals_out,num_elem,shape_par,scale_par);
+    rgamma_fill(shape_par,scale_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -159,9 +288,17 @@ rgamma_vec(const T1 shape_par, const T2 scale_par, rT* __stats_pointer_settings_
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-rgamma_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 scale_par)
+rgamma_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 scale_par, const ullint_t seed_val)
+{
+    STDVEC_RAND_DIST_FN(rgamma,shape_par,scale_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rgamma_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 scale_par, rngT& engine)
 {
-    STDVEC_RAND_DIST_FN(rgamma,shape_par,scale_par);
+    STDVEC_RAND_DIST_FN(rgamma,shape_par,scale_par,engine);
 }
 #endif
 
@@ -169,9 +306,17 @@ rgamma_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 scale_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-rgamma_mat_check(mT& X, const T1 shape_par, const T2 scale_par)
+rgamma_mat_check(mT& X, const T1 shape_par, const T2 scale_par, const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rgamma,shape_par,scale_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rgamma_mat_check(mT& X, const T1 shape_par, const T2 scale_par, rngT& engine)
 {
-    MAIN_MAT_RAND_DIST_FN(rgamma,shape_par,scale_par);
+    MAIN_MAT_RAND_DIST_FN(rgamma,shape_par,scale_par,engine);
 }
 #endif
 
@@ -184,6 +329,7 @@ rgamma_mat_check(mT& X, const T1 shape_par, const T2 scale_par)
  * @param k the number of output columns
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Gamma distribution.
  *
@@ -199,6 +345,8 @@ rgamma_mat_check(mT& X, const T1 shape_par, const T2 scale_par)
  * stats::rgamma<Eigen::MatrixXd>(5,4,3.0,2.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -206,8 +354,47 @@ rgamma_mat_check(mT& X, const T1 shape_par, const T2 scale_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par)
+rgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rgamma_mat_check,shape_par,scale_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Gamma distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Gamma distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rgamma<std::vector<double>>(5,4,3.0,2.0,engine);
+ * // Armadillo matrix
+ * stats::rgamma<arma::mat>(5,4,3.0,2.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rgamma<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,3.0,2.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rgamma<Eigen::MatrixXd>(5,4,3.0,2.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rgamma_mat_check,shape_par,scale_par);
+    GEN_MAT_RAND_FN(rgamma_mat_check,shape_par,scale_par,engine);
 }
 #endif
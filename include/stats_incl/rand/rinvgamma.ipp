@@ -25,10 +25,10 @@
 namespace internal
 {
 
-template<typename T>
+template<typename T, typename rngT>
 statslib_inline
 T
-rinvgamma_compute(T shape_par, T rate_par, rand_engine_t& engine)
+rinvgamma_compute(T shape_par, T rate_par, rngT& engine)
 {
     return( !invgamma_sanity_check(shape_par,rate_par) ? \
                 STLIM<T>::quiet_NaN() :
@@ -36,10 +36,10 @@ rinvgamma_compute(T shape_par, T rate_par, rand_engine_t& engine)
             T(1) / rgamma(shape_par,T(1)/rate_par,engine) );
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-rinvgamma_type_check(const T1 shape_par, const T2 rate_par, rand_engine_t& engine)
+rinvgamma_type_check(const T1 shape_par, const T2 rate_par, rngT& engine)
 noexcept
 {
     return rinvgamma_compute(static_cast<TC>(shape_par),static_cast<TC>(rate_par),engine);
@@ -63,10 +63,10 @@ noexcept
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2>
-rinvgamma(const T1 shape_par, const T2 rate_par, rand_engine_t& engine)
+rinvgamma(const T1 shape_par, const T2 rate_par, rngT& engine)
 {
     return internal::rinvgamma_type_check(shape_par,rate_par,engine);
 }
@@ -95,6 +95,30 @@ rinvgamma(const T1 shape_par, const T2 rate_par, const ullint_t seed_val)
     return rinvgamma(shape_par,rate_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Inverse-Gamma distribution
+ *
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param rate_par the rate parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Inverse-Gamma distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rinvgamma(3.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rinvgamma(const T1 shape_par, const T2 rate_par)
+{
+    return rinvgamma(shape_par,rate_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -105,9 +129,17 @@ namespace internal
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-rinvgamma_vec(const T1 shape_par, const T2 rate_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rinvgamma_vec(const T1 shape_par, const T2 rate_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rinvgamma,vals_out,num_elem,shape_par,rate_par);
+    RAND_DIST_FN_VEC(rinvgamma,vals_out,num_elem,seed_val,shape_par,rate_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+rinvgamma_vec(const T1 shape_par, const T2 rate_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_ENGINE(rinvgamma,vals_out,num_elem,engine,shape_par,rate_par);
 }
 #endif
 
@@ -115,9 +147,17 @@ rinvgamma_vec(const T1 shape_par, const T2 rate_par, rT* __stats_pointer_setting
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-rinvgamma_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 rate_par)
+rinvgamma_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 rate_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(rinvgamma,shape_par,rate_par);
+    STDVEC_RAND_DIST_FN(rinvgamma,shape_par,rate_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rinvgamma_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 rate_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rinvgamma,shape_par,rate_par,engine);
 }
 #endif
 
@@ -125,9 +165,17 @@ rinvgamma_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 rate_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-rinvgamma_mat_check(mT& X, const T1 shape_par, const T2 rate_par)
+rinvgamma_mat_check(mT& X, const T1 shape_par, const T2 rate_par, const ullint_t seed_val)
 {
-    MAIN_MAT_RAND_DIST_FN(rinvgamma,shape_par,rate_par);
+    MAIN_MAT_RAND_DIST_FN(rinvgamma,shape_par,rate_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rinvgamma_mat_check(mT& X, const T1 shape_par, const T2 rate_par, rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rinvgamma,shape_par,rate_par,engine);
 }
 #endif
 
@@ -140,6 +188,7 @@ rinvgamma_mat_check(mT& X, const T1 shape_par, const T2 rate_par)
  * @param k the number of output columns
  * @param shape_par the shape parameter, a real-valued input.
  * @param rate_par the rate parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Inverse-Gamma distribution.
  *
@@ -155,6 +204,8 @@ rinvgamma_mat_check(mT& X, const T1 shape_par, const T2 rate_par)
  * stats::rinvgamma<Eigen::MatrixXd>(5,4,3.0,2.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -162,8 +213,47 @@ rinvgamma_mat_check(mT& X, const T1 shape_par, const T2 rate_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par)
+rinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rinvgamma_mat_check,shape_par,rate_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Inverse-Gamma distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param rate_par the rate parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Inverse-Gamma distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rinvgamma<std::vector<double>>(5,4,3.0,2.0,engine);
+ * // Armadillo matrix
+ * stats::rinvgamma<arma::mat>(5,4,3.0,2.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rinvgamma<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,3.0,2.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rinvgamma<Eigen::MatrixXd>(5,4,3.0,2.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rinvgamma(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 rate_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rinvgamma_mat_check,shape_par,rate_par);
+    GEN_MAT_RAND_FN(rinvgamma_mat_check,shape_par,rate_par,engine);
 }
 #endif
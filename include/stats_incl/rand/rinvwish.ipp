@@ -27,15 +27,16 @@
  *
  * @param Psi_par a positive semi-definite scale matrix.
  * @param nu_par the degrees of parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
  * @param pre_inv_chol indicate whether \c Psi_par has been inverted and passed in lower triangular (Cholesky) format.
  *
  * @return a pseudo-random draw from the Inverse-Wishart distribution.
  */
 
-template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
+template<typename mT, typename pT, typename rngT, typename not_arma_mat<mT>::type*, typename enable_if_engine<rngT>::type*>
 statslib_inline
 mT
-rinvwish(const mT& Psi_par, const pT nu_par, const bool pre_inv_chol)
+rinvwish(const mT& Psi_par, const pT nu_par, rngT& engine, const bool pre_inv_chol)
 {
     typedef return_t<pT> eT;
     const ullint_t K = mat_ops::n_rows(Psi_par);
@@ -49,8 +50,6 @@ rinvwish(const mT& Psi_par, const pT nu_par, const bool pre_inv_chol)
 
     //
 
-    rand_engine_t engine(std::random_device{}());
-
     mT A;
     mat_ops::zeros(A,K,K);
 
@@ -73,11 +72,29 @@ rinvwish(const mT& Psi_par, const pT nu_par, const bool pre_inv_chol)
     return mat_ops::inv( mat_out_inv );
 }
 
+/**
+ * @brief Random sampling function for the Inverse-Wishart distribution
+ *
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param pre_inv_chol indicate whether \c Psi_par has been inverted and passed in lower triangular (Cholesky) format.
+ *
+ * @return a pseudo-random draw from the Inverse-Wishart distribution.
+ */
+
+template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
+statslib_inline
+mT
+rinvwish(const mT& Psi_par, const pT nu_par, const bool pre_inv_chol)
+{
+    return rinvwish(Psi_par,nu_par,internal::default_engine(),pre_inv_chol);
+}
+
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
-template<typename mT, typename eT, typename pT>
+template<typename mT, typename eT, typename pT, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 mT
-rinvwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_inv_chol)
+rinvwish(const ArmaMat<eT>& Psi_par, const pT nu_par, rngT& engine, const bool pre_inv_chol)
 {
     const ullint_t K = Psi_par.n_rows;
     
@@ -85,8 +102,6 @@ rinvwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_inv_chol)
 
     //
 
-    rand_engine_t engine(std::random_device{}());
-
     ArmaMat<eT> A = arma::zeros(K,K);
 
     for (ullint_t i=1U; i < K; i++) {
@@ -105,4 +120,12 @@ rinvwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_inv_chol)
     
     return arma::inv(chol_Psi * chol_Psi.t());
 }
+
+template<typename mT, typename eT, typename pT>
+statslib_inline
+mT
+rinvwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_inv_chol)
+{
+    return rinvwish<mT>(Psi_par,nu_par,internal::default_engine(),pre_inv_chol);
+}
 #endif
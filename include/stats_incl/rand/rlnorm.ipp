@@ -28,10 +28,10 @@
 namespace internal
 {
 
-template<typename T>
+template<typename T, typename rngT>
 statslib_inline
 T
-rlnorm_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
+rlnorm_compute(const T mu_par, const T sigma_par, rngT& engine)
 {
     return( !lnorm_sanity_check(mu_par,sigma_par) ? \
                 STLIM<T>::quiet_NaN() :
@@ -39,10 +39,10 @@ rlnorm_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
             stmath::exp(rnorm(mu_par,sigma_par,engine)) );
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_inline
 TC
-rlnorm_type_check(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
+rlnorm_type_check(const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
     return rlnorm_compute(static_cast<TC>(mu_par),static_cast<TC>(sigma_par),engine);
 }
@@ -65,10 +65,10 @@ rlnorm_type_check(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2>
-rlnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
+rlnorm(const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
     return internal::rlnorm_type_check(mu_par,sigma_par,engine);
 }
@@ -97,6 +97,30 @@ rlnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
     return rlnorm(mu_par,sigma_par,engine);
 }
 
+/**
+ * Random sampling function for the Log-Normal distribution
+ *
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Log-Normal distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rlnorm(1.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rlnorm(const T1 mu_par, const T2 sigma_par)
+{
+    return rlnorm(mu_par,sigma_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -104,12 +128,67 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+// bulk fill: a batch of Normal draws is generated, then exponentiated by the batch kernel
+
+template<typename T1, typename T2, typename rngT, typename rT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+void
+rlnorm_fill(const T1 mu_par, const T2 sigma_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC mu_par_c = static_cast<TC>(mu_par);
+    const TC sigma_par_c = static_cast<TC>(sigma_par);
+
+    if (!lnorm_sanity_check(mu_par_c,sigma_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    const double mu_par_d = static_cast<double>(mu_par_c);
+    const double sigma_par_d = static_cast<double>(sigma_par_c);
+
+    const rnorm_zig_tables& zig_tables = rnorm_zig_get_tables();
+
+    double batch_vals[STATS_RAND_UNIF_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+
+    for (ullint_t j=ullint_t(0); j < num_elem; j += ullint_t(STATS_RAND_UNIF_BATCH_SIZE))
+    {
+        const ullint_t n_batch = std::min(ullint_t(STATS_RAND_UNIF_BATCH_SIZE), num_elem - j);
+        const ullint_t n_padded = (n_batch + STATS_BATCH_MATH_WIDTH - ullint_t(1)) / STATS_BATCH_MATH_WIDTH * STATS_BATCH_MATH_WIDTH;
+
+        for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+            batch_vals[i] = mu_par_d + sigma_par_d*rnorm_zig_draw(zig_tables,engine);
+        }
+
+        for (ullint_t i=n_batch; i < n_padded; ++i) {
+            batch_vals[i] = 0.0;
+        }
+
+        batch_exp(batch_vals,n_padded);
+
+        for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+            vals_out[j + i] = static_cast<rT>(batch_vals[i]);
+        }
+    }
+}
+
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-rlnorm_vec(const T1 mu_par, const T2 sigma_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rlnorm_vec(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rlnorm_fill,vals_out,num_elem,seed_val,mu_par,sigma_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+rlnorm_vec(const T1 mu_par, const T2 sigma_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rlnorm,vals_out,num_elem,mu_par,sigma_par);
+    rlnorm_fill(mu_par,sigma_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -117,9 +196,17 @@ rlnorm_vec(const T1 mu_par, const T2 sigma_par, rT* __stats_pointer_settings__ v
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-rlnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par)
+rlnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(rlnorm,mu_par,sigma_par);
+    STDVEC_RAND_DIST_FN(rlnorm,mu_par,sigma_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rlnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rlnorm,mu_par,sigma_par,engine);
 }
 #endif
 
@@ -127,9 +214,17 @@ rlnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-rlnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
+rlnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
 {
-    MAIN_MAT_RAND_DIST_FN(rlnorm,mu_par,sigma_par);
+    MAIN_MAT_RAND_DIST_FN(rlnorm,mu_par,sigma_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rlnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par, rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rlnorm,mu_par,sigma_par,engine);
 }
 #endif
 
@@ -142,6 +237,7 @@ rlnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
  * @param k the number of output columns
  * @param mu_par the location parameter, a real-valued input.
  * @param sigma_par the scale parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Log-Normal distribution.
  *
@@ -157,6 +253,8 @@ rlnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
  * stats::rlnorm<Eigen::MatrixXd>(5,4,1.0,2.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -164,8 +262,47 @@ rlnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par)
+rlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rlnorm_mat_check,mu_par,sigma_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Log-Normal distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param mu_par the location parameter, a real-valued input.
+ * @param sigma_par the scale parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Log-Normal distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rlnorm<std::vector<double>>(5,4,1.0,2.0,engine);
+ * // Armadillo matrix
+ * stats::rlnorm<arma::mat>(5,4,1.0,2.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rlnorm<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,1.0,2.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rlnorm<Eigen::MatrixXd>(5,4,1.0,2.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rlnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rlnorm_mat_check,mu_par,sigma_par);
+    GEN_MAT_RAND_FN(rlnorm_mat_check,mu_par,sigma_par,engine);
 }
 #endif
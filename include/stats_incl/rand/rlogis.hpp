@@ -28,24 +28,36 @@
 //
 // scalar output
 
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+common_return_t<T1,T2>
+rlogis(const T1 mu_par, const T2 sigma_par, rngT& engine);
+
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rlogis(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rlogis(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val);
 
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rlogis(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rlogis(const T1 mu_par, const T2 sigma_par);
 
 //
 // vector/matrix output
 
-#ifdef STATS_ENABLE_MATRIX_FEATURES
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par);
+rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par,
+       const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rlogis(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par,
+       rngT& engine);
 #endif
 
 //
@@ -27,10 +27,36 @@
 
 #ifdef STATS_ENABLE_MATRIX_FEATURES
 
+// single draw; the number of trials equals the number of categories
+
 template<typename mT, typename eT = double>
 statslib_inline
 mT rmultinom(const mT& prob);
 
+template<typename mT, typename rngT, typename eT = double, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT rmultinom(const mT& prob, rngT& engine);
+
+// single draw
+
+template<typename mT, typename eT = double>
+statslib_inline
+mT rmultinom(const ullint_t n_trials, const mT& prob);
+
+template<typename mT, typename rngT, typename eT = double, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT rmultinom(const ullint_t n_trials, const mT& prob, rngT& engine);
+
+// n draws, one per row
+
+template<typename mT, typename eT = double>
+statslib_inline
+mT rmultinom(const ullint_t n_draws, const ullint_t n_trials, const mT& prob);
+
+template<typename mT, typename rngT, typename eT = double, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT rmultinom(const ullint_t n_draws, const ullint_t n_trials, const mT& prob, rngT& engine);
+
 #include "rmultinom.ipp"
 
 #endif
@@ -22,38 +22,241 @@
  * Sample from a multinomial distribution
  */
 
-template<typename mT, typename eT>
+namespace internal
+{
+
+#ifndef STATS_RMULTINOM_ALIAS_FACTOR
+    #define STATS_RMULTINOM_ALIAS_FACTOR 16 // use alias-based counting if n_trials < factor * n_categories
+#endif
+
+// conditional binomial method: O(k) binomial draws, independent of the number of trials
+
+template<typename rngT>
 statslib_inline
-mT
-rmultinom(const mT& prob)
+void
+rmultinom_cond_binom(const ullint_t n_trials, const alias_table& cat_table, rngT& engine, ullint_t* counts)
 {
-    const ullint_t n_prob = mat_ops::n_elem(prob);
+    const ullint_t n_cat = cat_table.size();
 
-    ullint_t n_j = n_prob;
+    ullint_t n_left = n_trials;
+    double prob_left = 1.0;
 
-    //
+    for (ullint_t j = 0; j < n_cat; ++j)
+    {
+        if (n_left == ullint_t(0)) {
+            counts[j] = 0;
+            continue;
+        }
 
-    mT ret(n_prob,1);
-    const mT prob_csum = mat_ops::cumsum(prob);
+        if (j == n_cat - 1U) {
+            counts[j] = n_left;
+            break;
+        }
 
-    eT p_j = prob(0,0);
-    ret(0,0) = rbinom(n_j,p_j);
+        const double prob_j = cat_table.prob(j);
+        const double prob_cond = (prob_left > prob_j) ? prob_j / prob_left : 1.0;
 
-    //
+        counts[j] = static_cast<ullint_t>(rbinom_compute(static_cast<llint_t>(n_left),prob_cond,engine));
+
+        n_left -= counts[j];
+        prob_left -= prob_j;
+    }
+}
+
+// alias-based counting: O(n) categorical draws
+
+template<typename rngT>
+statslib_inline
+void
+rmultinom_alias(const ullint_t n_trials, const alias_table& cat_table, rngT& engine, ullint_t* counts)
+{
+    std::fill(counts, counts + cat_table.size(), ullint_t(0));
+
+    for (ullint_t i = 0; i < n_trials; ++i) {
+        ++counts[cat_table(engine)];
+    }
+}
+
+template<typename mT, typename rngT, typename eT>
+statslib_inline
+mT
+rmultinom_compute(const ullint_t n_draws, const ullint_t n_trials, const mT& prob, rngT& engine, const bool draws_in_rows)
+{
+    const ullint_t n_cat = mat_ops::n_elem(prob);
+
+    std::vector<double> prob_vals(n_cat);
+
+    for (ullint_t j = 0; j < n_cat; ++j) {
+        prob_vals[j] = static_cast<double>(prob(j,0));
+    }
 
-    ullint_t ret_sum = ret(0,0);
-    
-    for (ullint_t j = 1U; j < n_prob; j++)
+    const alias_table cat_table(prob_vals);
+
+    mT ret = draws_in_rows ? mT(n_draws,n_cat) : mT(n_cat,n_draws);
+
+    if (cat_table.size() == ullint_t(0))
     {
-        p_j = prob(j,0) / (eT(1) - prob_csum(j-1,0));
-        n_j = n_prob - ret_sum;
-        
-        ret(j,0) = rbinom(n_j,p_j);
-        
-        ret_sum += ret(j,0);
+        for (ullint_t i = 0; i < n_draws; ++i) {
+            for (ullint_t j = 0; j < n_cat; ++j) {
+                (draws_in_rows ? ret(i,j) : ret(j,i)) = STLIM<eT>::quiet_NaN();
+            }
+        }
+
+        return ret;
     }
 
     //
 
+    const bool use_alias = (n_trials < ullint_t(STATS_RMULTINOM_ALIAS_FACTOR) * n_cat);
+
+    std::vector<ullint_t> counts(n_cat);
+
+    for (ullint_t i = 0; i < n_draws; ++i)
+    {
+        if (use_alias) {
+            rmultinom_alias(n_trials,cat_table,engine,counts.data());
+        } else {
+            rmultinom_cond_binom(n_trials,cat_table,engine,counts.data());
+        }
+
+        for (ullint_t j = 0; j < n_cat; ++j) {
+            (draws_in_rows ? ret(i,j) : ret(j,i)) = static_cast<eT>(counts[j]);
+        }
+    }
+
     return ret;
 }
+
+}
+
+/**
+ * @brief Random sampling function for the Multinomial distribution
+ *
+ * @param n_trials the number of trials, a non-negative integral-valued input.
+ * @param prob a column vector of \c k non-negative category probabilities (normalized internally).
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a \c k-by-1 vector of category counts.
+ *
+ * Draws use alias-based counting (Walker, 1977) if the number of trials is small relative to \c k,
+ * and the conditional binomial method otherwise; the expected cost is <tt>O(min(n_trials, k))</tt> after an <tt>O(k)</tt> setup.
+ *
+ * Example:
+ * \code{.cpp}
+ * arma::vec prob = {0.1, 0.2, 0.7};
+ * stats::rand_engine_t engine(1776);
+ * stats::rmultinom(100,prob,engine);
+ * \endcode
+ */
+
+template<typename mT, typename rngT, typename eT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rmultinom(const ullint_t n_trials, const mT& prob, rngT& engine)
+{
+    return internal::rmultinom_compute<mT,rngT,eT>(1,n_trials,prob,engine,false);
+}
+
+/**
+ * @brief Random sampling function for the Multinomial distribution
+ *
+ * @param n_trials the number of trials, a non-negative integral-valued input.
+ * @param prob a column vector of \c k non-negative category probabilities (normalized internally).
+ *
+ * @return a \c k-by-1 vector of category counts.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * arma::vec prob = {0.1, 0.2, 0.7};
+ * stats::rmultinom(100,prob);
+ * \endcode
+ */
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+rmultinom(const ullint_t n_trials, const mT& prob)
+{
+    return rmultinom<mT,xoshiro256pp,eT>(n_trials,prob,internal::default_engine());
+}
+
+/**
+ * @brief Random sampling function for the Multinomial distribution, with the number of trials equal to the number of categories
+ *
+ * @param prob a column vector of \c k non-negative category probabilities (normalized internally).
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a \c k-by-1 vector of category counts.
+ */
+
+template<typename mT, typename rngT, typename eT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rmultinom(const mT& prob, rngT& engine)
+{
+    return rmultinom<mT,rngT,eT>(mat_ops::n_elem(prob),prob,engine);
+}
+
+/**
+ * @brief Random sampling function for the Multinomial distribution, with the number of trials equal to the number of categories
+ *
+ * @param prob a column vector of \c k non-negative category probabilities (normalized internally).
+ *
+ * @return a \c k-by-1 vector of category counts.
+ */
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+rmultinom(const mT& prob)
+{
+    return rmultinom<mT,xoshiro256pp,eT>(prob,internal::default_engine());
+}
+
+/**
+ * @brief Random matrix sampling function for the Multinomial distribution
+ *
+ * @param n_draws the number of independent draws (output rows).
+ * @param n_trials the number of trials per draw, a non-negative integral-valued input.
+ * @param prob a column vector of \c k non-negative category probabilities (normalized internally).
+ * @param engine a random engine, passed by reference.
+ *
+ * @return an \c n_draws-by-\c k matrix of category counts; the alias table is built once for all draws.
+ *
+ * Example:
+ * \code{.cpp}
+ * arma::vec prob = {0.1, 0.2, 0.7};
+ * stats::rand_engine_t engine(1776);
+ * stats::rmultinom(1000,100,prob,engine);
+ * \endcode
+ */
+
+template<typename mT, typename rngT, typename eT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rmultinom(const ullint_t n_draws, const ullint_t n_trials, const mT& prob, rngT& engine)
+{
+    return internal::rmultinom_compute<mT,rngT,eT>(n_draws,n_trials,prob,engine,true);
+}
+
+/**
+ * @brief Random matrix sampling function for the Multinomial distribution
+ *
+ * @param n_draws the number of independent draws (output rows).
+ * @param n_trials the number of trials per draw, a non-negative integral-valued input.
+ * @param prob a column vector of \c k non-negative category probabilities (normalized internally).
+ *
+ * @return an \c n_draws-by-\c k matrix of category counts.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ */
+
+template<typename mT, typename eT>
+statslib_inline
+mT
+rmultinom(const ullint_t n_draws, const ullint_t n_trials, const mT& prob)
+{
+    return rmultinom<mT,xoshiro256pp,eT>(n_draws,n_trials,prob,internal::default_engine());
+}
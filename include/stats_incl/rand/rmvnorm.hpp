@@ -32,20 +32,36 @@ template<typename vT, typename mT, typename not_arma_mat<mT>::type* = nullptr>
 statslib_inline
 vT rmvnorm(const vT& mu_par, const mT& Sigma_par, const bool pre_chol = false);
 
+template<typename vT, typename mT, typename rngT, typename not_arma_mat<mT>::type* = nullptr, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+vT rmvnorm(const vT& mu_par, const mT& Sigma_par, rngT& engine, const bool pre_chol = false);
+
 // n samples
 template<typename vT, typename mT, typename not_arma_mat<mT>::type* = nullptr>
 statslib_inline
 mT rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const bool pre_chol = false);
 
+template<typename vT, typename mT, typename rngT, typename not_arma_mat<mT>::type* = nullptr, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, rngT& engine, const bool pre_chol = false);
+
 // specializations
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename mT, typename eT>
 statslib_inline
 mT rmvnorm(const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol = false);
 
+template<typename mT, typename eT, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT rmvnorm(const mT& mu_par, const ArmaMat<eT>& Sigma_par, rngT& engine, const bool pre_chol = false);
+
 template<typename mT, typename eT>
 statslib_inline
 ArmaMat<eT> rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol = false);
+
+template<typename mT, typename eT, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+ArmaMat<eT> rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, rngT& engine, const bool pre_chol = false);
 #endif
 
 #include "rmvnorm.ipp"
@@ -58,6 +58,43 @@ rmvnorm(const vT& mu_par, const mT& Sigma_par, const bool pre_chol)
     return ret;
 }
 
+/**
+ * @brief Random sampling function for the Multivariate-Normal distribution
+ *
+ * @param mu_par mean vector.
+ * @param Sigma_par the covariance matrix.
+ * @param engine a random engine, passed by reference.
+ * @param pre_chol indicate whether \c Sigma_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return a pseudo-random draw from the Multivariate-Normal distribution.
+ */
+
+template<typename vT, typename mT, typename rngT, typename not_arma_mat<mT>::type*, typename enable_if_engine<rngT>::type*>
+statslib_inline
+vT
+rmvnorm(const vT& mu_par, const mT& Sigma_par, rngT& engine, const bool pre_chol)
+{
+    vT ret;
+
+    const ullint_t K = mat_ops::n_rows(Sigma_par);
+
+    if (mat_ops::n_elem(mu_par) != K)
+    {
+        printf("rmvnorm: dimensions of mu and Sigma do not agree.\n");
+        return ret;
+    }
+
+    //
+
+    const mT A = (pre_chol) ? Sigma_par : mat_ops::chol(Sigma_par); // should be lower-triangular
+
+    ret = mu_par + A * rnorm<vT>(K,1,0.0,1.0,engine);
+
+    //
+    
+    return ret;
+}
+
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 // Note: mu is templated as it could be of type Col<eT> or Mat<eT>
 template<typename mT, typename eT>
@@ -86,6 +123,32 @@ rmvnorm(const mT& mu_par, const ArmaMat<eT>& Sigma_par, const bool pre_chol)
     
     return ret;
 }
+
+template<typename mT, typename eT, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rmvnorm(const mT& mu_par, const ArmaMat<eT>& Sigma_par, rngT& engine, const bool pre_chol)
+{
+    mT ret;
+
+    const ullint_t K = Sigma_par.n_rows;
+
+    if (mu_par.n_elem != K)
+    {
+        printf("rmvnorm: dimensions of mu and Sigma do not agree.\n");
+        return ret;
+    }
+
+    //
+
+    const ArmaMat<eT> A = (pre_chol) ? Sigma_par : arma::chol(Sigma_par,"lower"); // should be lower-triangular
+
+    ret = mu_par + A * rnorm<ArmaMat<eT>>(K,1,eT(0),eT(1),engine);
+
+    //
+    
+    return ret;
+}
 #endif
 
 //
@@ -117,6 +180,32 @@ rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, const bool pre_
     return ret;
 }
 
+template<typename vT, typename mT, typename rngT, typename not_arma_mat<mT>::type*, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rmvnorm(const ullint_t n, const vT& mu_par, const mT& Sigma_par, rngT& engine, const bool pre_chol)
+{
+    mT ret;
+
+    const ullint_t K = mat_ops::n_rows(Sigma_par);
+
+    if (mat_ops::n_elem(mu_par) != K)
+    {
+        printf("rmvnorm: dimensions of mu and Sigma do not agree.\n");
+        return ret;
+    }
+
+    //
+
+    const mT A = (pre_chol) ? Sigma_par : mat_ops::chol(Sigma_par); // should be lower-triangular
+
+    ret = mat_ops::repmat(mat_ops::trans(mu_par),n,1) + rnorm<mT>(n,K,0.0,1.0,engine) * mat_ops::trans(A);
+
+    //
+    
+    return ret;
+}
+
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 // mu is templated as it could be of type Col<eT> or Mat<eT>
 template<typename mT, typename eT>
@@ -145,4 +234,30 @@ rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, const
     
     return ret;
 }
+
+template<typename mT, typename eT, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+ArmaMat<eT>
+rmvnorm(const ullint_t n, const mT& mu_par, const ArmaMat<eT>& Sigma_par, rngT& engine, const bool pre_chol)
+{
+    ArmaMat<eT> ret;
+
+    const ullint_t K = Sigma_par.n_rows;
+
+    if (mu_par.n_elem != K)
+    {
+        printf("rmvnorm: dimensions of mu and Sigma do not agree.\n");
+        return ret;
+    }
+
+    //
+
+    const ArmaMat<eT> A = (pre_chol) ? Sigma_par : arma::chol(Sigma_par,"lower"); // should be lower-triangular
+
+    ret = arma::repmat(mu_par.t(),n,1) + rnorm<ArmaMat<eT>>(n,K,eT(0),eT(1),engine) * A.t();
+
+    //
+    
+    return ret;
+}
 #endif
@@ -28,15 +28,20 @@
 //
 // scalar output
 
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+common_return_t<T1,T2>
+rnorm(const T1 mu_par, const T2 sigma_par, rngT& engine);
+
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine);
+rnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val);
 
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val = std::random_device{}());
+rnorm(const T1 mu_par, const T2 sigma_par);
 
 template<typename T = double>
 statslib_inline
@@ -49,7 +54,14 @@ T rnorm();
 template<typename mT, typename T1 = double, typename T2 = double>
 statslib_inline
 mT
-rnorm(const ullint_t n, const ullint_t k, const T1 mu_par = T1(0), const T2 sigma_par = T2(1));
+rnorm(const ullint_t n, const ullint_t k, const T1 mu_par = T1(0), const T2 sigma_par = T2(1),
+      const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par,
+      rngT& engine);
 #endif
 
 //
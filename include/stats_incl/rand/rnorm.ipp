@@ -28,10 +28,109 @@
 namespace internal
 {
 
-template<typename T>
+// Ziggurat method of Marsaglia and Tsang (2000), with 256 layers;
+// the layer index, sign, and a 52-bit abscissa are taken from a single 64-bit draw
+
+#ifndef STATS_ZIG_NORM_R
+    #define STATS_ZIG_NORM_R 3.6541528853610088 // start of the tail region
+#endif
+
+struct rnorm_zig_tables
+{
+    ullint_t k[256]; // acceptance thresholds for the rectangular part of each layer
+    double w[256];   // abscissa scaling for each layer
+    double f[256];   // density values at the layer boundaries
+
+    rnorm_zig_tables()
+    {
+        const double m1 = 4503599627370496.0; // 2^52
+        const double v_n = 4.92867323399e-3;  // area of each layer
+
+        double d_n = STATS_ZIG_NORM_R;
+        double t_n = d_n;
+
+        const double q = v_n / std::exp(-0.5*d_n*d_n);
+
+        k[0] = static_cast<ullint_t>((d_n/q)*m1);
+        k[1] = 0;
+
+        w[0] = q / m1;
+        w[255] = d_n / m1;
+
+        f[0] = 1.0;
+        f[255] = std::exp(-0.5*d_n*d_n);
+
+        for (int i = 254; i >= 1; --i)
+        {
+            d_n = std::sqrt(-2.0*std::log(v_n/d_n + std::exp(-0.5*d_n*d_n)));
+
+            k[i+1] = static_cast<ullint_t>((d_n/t_n)*m1);
+            t_n = d_n;
+
+            f[i] = std::exp(-0.5*d_n*d_n);
+            w[i] = d_n / m1;
+        }
+    }
+};
+
+statslib_inline
+const rnorm_zig_tables&
+rnorm_zig_get_tables()
+{
+    static const rnorm_zig_tables zig_tables;
+    return zig_tables;
+}
+
+template<typename rngT>
+statslib_inline
+double
+rnorm_zig_draw(const rnorm_zig_tables& zig_tables, rngT& engine)
+{
+    while (true)
+    {
+        const ullint_t rand_val = rand_bits64(engine);
+
+        const uint_t layer_ind = static_cast<uint_t>(rand_val & 0xFFU);
+        const bool neg_sign = ((rand_val >> 8) & 1U) == 1U;
+        const ullint_t rand_abs = (rand_val >> 9) & 0x000FFFFFFFFFFFFFULL;
+
+        const double x = (neg_sign ? -1.0 : 1.0) * static_cast<double>(rand_abs) * zig_tables.w[layer_ind];
+
+        if (rand_abs < zig_tables.k[layer_ind]) {
+            return x; // rectangular part; the common case
+        }
+
+        if (layer_ind == 0U)
+        {
+            // tail beyond STATS_ZIG_NORM_R (Marsaglia, 1964)
+
+            while (true)
+            {
+                const double x_tail = - std::log1p(- rand_unif53(engine)) / STATS_ZIG_NORM_R;
+                const double y_tail = - std::log1p(- rand_unif53(engine));
+
+                if (y_tail + y_tail > x_tail*x_tail) {
+                    return neg_sign ? - (STATS_ZIG_NORM_R + x_tail) : STATS_ZIG_NORM_R + x_tail;
+                }
+            }
+        }
+        else
+        {
+            // wedge
+
+            const double f_val = zig_tables.f[layer_ind] + (zig_tables.f[layer_ind-1] - zig_tables.f[layer_ind]) * rand_unif53(engine);
+
+            if (f_val < std::exp(-0.5*x*x)) {
+                return x;
+            }
+        }
+    }
+}
+
+template<typename T, typename rngT>
 statslib_inline
 T
-rnorm_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
+rnorm_compute(const T mu_par, const T sigma_par, rngT& engine)
 {
     if (!norm_sanity_check(mu_par,sigma_par)) {
         return STLIM<T>::quiet_NaN();
@@ -39,15 +138,13 @@ rnorm_compute(const T mu_par, const T sigma_par, rand_engine_t& engine)
 
     //
 
-    std::normal_distribution<T> norm_dist(T(0),T(1));
-
-    return mu_par + sigma_par*norm_dist(engine);
+    return mu_par + sigma_par*static_cast<T>(rnorm_zig_draw(rnorm_zig_get_tables(),engine));
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_inline
 TC
-rnorm_type_check(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
+rnorm_type_check(const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
     return rnorm_compute(static_cast<TC>(mu_par),static_cast<TC>(sigma_par),engine);
 }
@@ -70,10 +167,10 @@ rnorm_type_check(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2>
-rnorm(const T1 mu_par, const T2 sigma_par, rand_engine_t& engine)
+rnorm(const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
     return internal::rnorm_type_check(mu_par,sigma_par,engine);
 }
@@ -102,6 +199,30 @@ rnorm(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
     return rnorm(mu_par,sigma_par,engine);
 }
 
+/**
+ * Random sampling function for the Normal distribution
+ *
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Normal distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rnorm(1.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rnorm(const T1 mu_par, const T2 sigma_par)
+{
+    return rnorm(mu_par,sigma_par,internal::default_engine());
+}
+
 /**
  * Random sampling function for the Standard Normal distribution
  *
@@ -127,12 +248,48 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk fill: the sanity check and table lookup are done once for all draws
+
+template<typename T1, typename T2, typename rngT, typename rT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+void
+rnorm_fill(const T1 mu_par, const T2 sigma_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC mu_par_c = static_cast<TC>(mu_par);
+    const TC sigma_par_c = static_cast<TC>(sigma_par);
+
+    if (!norm_sanity_check(mu_par_c,sigma_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    const rnorm_zig_tables& zig_tables = rnorm_zig_get_tables();
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = static_cast<rT>(mu_par_c + sigma_par_c*static_cast<TC>(rnorm_zig_draw(zig_tables,engine)));
+    }
+}
+
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-rnorm_vec(const T1 mu_par, const T2 sigma_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rnorm_vec(const T1 mu_par, const T2 sigma_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rnorm_fill,vals_out,num_elem,seed_val,mu_par,sigma_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+rnorm_vec(const T1 mu_par, const T2 sigma_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rnorm,vals_out,num_elem,mu_par,sigma_par);
+    rnorm_fill(mu_par,sigma_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -140,9 +297,17 @@ rnorm_vec(const T1 mu_par, const T2 sigma_par, rT* __stats_pointer_settings__ va
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-rnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par)
+rnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(rnorm,mu_par,sigma_par);
+    STDVEC_RAND_DIST_FN(rnorm,mu_par,sigma_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rnorm,mu_par,sigma_par,engine);
 }
 #endif
 
@@ -150,9 +315,17 @@ rnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-rnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
+rnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rnorm,mu_par,sigma_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
-    MAIN_MAT_RAND_DIST_FN(rnorm,mu_par,sigma_par);
+    MAIN_MAT_RAND_DIST_FN(rnorm,mu_par,sigma_par,engine);
 }
 #endif
 
@@ -165,6 +338,7 @@ rnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
  * @param k the number of output columns
  * @param mu_par the mean parameter, a real-valued input.
  * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Normal distribution.
  *
@@ -180,6 +354,8 @@ rnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
  * stats::rnorm<Eigen::MatrixXd>(5,4,1.0,2.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -187,8 +363,47 @@ rnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par)
+rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rnorm_mat_check,mu_par,sigma_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Normal distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Normal distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rnorm<std::vector<double>>(5,4,1.0,2.0,engine);
+ * // Armadillo matrix
+ * stats::rnorm<arma::mat>(5,4,1.0,2.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rnorm<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,1.0,2.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rnorm<Eigen::MatrixXd>(5,4,1.0,2.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rnorm_mat_check,mu_par,sigma_par);
+    GEN_MAT_RAND_FN(rnorm_mat_check,mu_par,sigma_par,engine);
 }
 #endif
@@ -28,15 +28,20 @@
 //
 // scalar output
 
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+return_t<T>
+rpois(const T rate_par, rngT& engine);
+
 template<typename T>
 statslib_inline
 return_t<T>
-rpois(const T rate_par, rand_engine_t& engine);
+rpois(const T rate_par, const ullint_t seed_val);
 
 template<typename T>
 statslib_inline
 return_t<T>
-rpois(const T rate_par, const ullint_t seed_val = std::random_device{}());
+rpois(const T rate_par);
 
 //
 // vector/matrix output
@@ -45,7 +50,14 @@ rpois(const T rate_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rpois(const ullint_t n, const ullint_t k, const T1 rate_par);
+rpois(const ullint_t n, const ullint_t k, const T1 rate_par,
+      const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rpois(const ullint_t n, const ullint_t k, const T1 rate_par,
+      rngT& engine);
 #endif
 
 //
@@ -28,15 +28,142 @@
 namespace internal
 {
 
-template<typename T>
+// log-gamma function via Stirling's series; avoids the global state of std::lgamma
+
+statslib_inline
+double
+rpois_log_gamma(double x)
+{
+    static const double stirling_coef[10] = { 8.333333333333333e-02, -2.777777777777778e-03,
+                                               7.936507936507937e-04, -5.952380952380952e-04,
+                                               8.417508417508418e-04, -1.917526917526918e-03,
+                                               6.410256410256410e-03, -2.955065359477124e-02,
+                                               1.796443723688307e-01, -1.39243221690590e+00 };
+
+    if (x == 1.0 || x == 2.0) {
+        return 0.0;
+    }
+
+    const int n_shift = (x < 7.0) ? static_cast<int>(7.0 - x) : 0;
+
+    double x_0 = x + n_shift;
+    const double x_2 = 1.0 / (x_0*x_0);
+
+    double series_val = stirling_coef[9];
+
+    for (int k = 8; k >= 0; --k) {
+        series_val = series_val*x_2 + stirling_coef[k];
+    }
+
+    double ret = series_val / x_0 + 0.5*std::log(2.0*GCEM_PI) + (x_0 - 0.5)*std::log(x_0) - x_0;
+
+    for (int k = 1; k <= n_shift; ++k) {
+        ret -= std::log(x_0 - 1.0);
+        x_0 -= 1.0;
+    }
+
+    return ret;
+}
+
+#ifndef STATS_RPOIS_PTRS_MIN_RATE
+    #define STATS_RPOIS_PTRS_MIN_RATE 10.0 // switch from multiplicative inversion to PTRS
+#endif
+
+// multiplicative inversion (Knuth) for small rates; expected cost O(rate)
+
+template<typename rngT>
+statslib_inline
+double
+rpois_mult(const double rate_par, rngT& engine)
+{
+    const double exp_rate = std::exp(-rate_par);
+
+    double x = 0.0;
+    double prod = rand_unif53(engine);
+
+    while (prod > exp_rate)
+    {
+        x += 1.0;
+        prod *= rand_unif53(engine);
+    }
+
+    return x;
+}
+
+// PTRS: transformed rejection with squeeze (Hormann, 1993), for rates >= STATS_RPOIS_PTRS_MIN_RATE;
+// the constants depend only on the rate, so are computed once for repeated draws
+
+struct rpois_ptrs_pars
+{
+    double rate;
+    double log_rate;
+    double a;
+    double b;
+    double log_inv_alpha;
+    double v_r;
+
+    explicit rpois_ptrs_pars(const double rate_par)
+    {
+        const double sqrt_rate = std::sqrt(rate_par);
+
+        rate = rate_par;
+        log_rate = std::log(rate_par);
+
+        b = 0.931 + 2.53*sqrt_rate;
+        a = -0.059 + 0.02483*b;
+        log_inv_alpha = std::log(1.1239 + 1.1328 / (b - 3.4));
+        v_r = 0.9277 - 3.6224 / (b - 2.0);
+    }
+};
+
+template<typename rngT>
+statslib_inline
+double
+rpois_ptrs(const rpois_ptrs_pars& pars, rngT& engine)
+{
+    while (true)
+    {
+        const double u = rand_unif53(engine) - 0.5;
+        const double v = rand_unif53(engine);
+        const double u_s = 0.5 - std::abs(u);
+
+        const double k = std::floor((2.0*pars.a / u_s + pars.b) * u + pars.rate + 0.43);
+
+        if (u_s >= 0.07 && v <= pars.v_r) {
+            return k; // squeeze acceptance
+        }
+
+        if (k < 0.0 || (u_s < 0.013 && v > u_s)) {
+            continue;
+        }
+
+        if ( std::log(v) + pars.log_inv_alpha - std::log(pars.a / (u_s*u_s) + pars.b) \
+                <= - pars.rate + k*pars.log_rate - rpois_log_gamma(k + 1.0) ) {
+            return k;
+        }
+    }
+}
+
+template<typename rngT>
+statslib_inline
+double
+rpois_draw(const double rate_par, rngT& engine)
+{
+    return( rate_par >= STATS_RPOIS_PTRS_MIN_RATE ? \
+                rpois_ptrs(rpois_ptrs_pars(rate_par),engine) :
+            //
+            rpois_mult(rate_par,engine) );
+}
+
+template<typename T, typename rngT>
 statslib_inline
 T
-rpois_compute(const T rate_par, rand_engine_t& engine)
+rpois_compute(const T rate_par, rngT& engine)
 {
     return( !pois_sanity_check(rate_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qpois(runif(T(0),T(1),engine),rate_par) );
+            static_cast<T>(rpois_draw(static_cast<double>(rate_par),engine)) );
 }
 
 }
@@ -52,14 +179,14 @@ rpois_compute(const T rate_par, rand_engine_t& engine)
  * Example:
  * \code{.cpp}
  * stats::rand_engine_t engine(1776);
- * stats::rchisq(4,engine);
+ * stats::rpois(4,engine);
  * \endcode
  */
 
-template<typename T>
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 return_t<T>
-rpois(const T rate_par, rand_engine_t& engine)
+rpois(const T rate_par, rngT& engine)
 {
     return internal::rpois_compute(static_cast<return_t<T>>(rate_par),engine);
 }
@@ -74,7 +201,7 @@ rpois(const T rate_par, rand_engine_t& engine)
  *
  * Example:
  * \code{.cpp}
- * stats::rchisq(4,1776);
+ * stats::rpois(4,1776);
  * \endcode
  */
 
@@ -87,6 +214,29 @@ rpois(const T rate_par, const ullint_t seed_val)
     return rpois(rate_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Poisson distribution
+ *
+ * @param rate_par the rate parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Poisson distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rpois(4,1776);
+ * \endcode
+ */
+
+template<typename T>
+statslib_inline
+return_t<T>
+rpois(const T rate_par)
+{
+    return rpois(rate_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -94,12 +244,57 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// bulk fill: the sanity check and the PTRS constants are computed once for all draws
+
+template<typename T1, typename rngT, typename rT>
+statslib_inline
+void
+rpois_fill(const T1 rate_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    using T = return_t<T1>;
+
+    if (!pois_sanity_check(static_cast<T>(rate_par)))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<T>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    const double rate_par_d = static_cast<double>(rate_par);
+
+    if (rate_par_d >= STATS_RPOIS_PTRS_MIN_RATE)
+    {
+        const rpois_ptrs_pars pars(rate_par_d);
+
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(rpois_ptrs(pars,engine));
+        }
+    }
+    else
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(rpois_mult(rate_par_d,engine));
+        }
+    }
+}
+
 template<typename T1, typename rT>
 statslib_inline
 void
-rpois_vec(const T1 rate_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rpois_vec(const T1 rate_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rpois,vals_out,num_elem,rate_par);
+    RAND_DIST_FN_VEC_FILL(rpois_fill,vals_out,num_elem,seed_val,rate_par);
+}
+
+template<typename T1, typename rngT, typename rT>
+statslib_inline
+void
+rpois_vec(const T1 rate_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    rpois_fill(rate_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -107,9 +302,17 @@ rpois_vec(const T1 rate_par, rT* __stats_pointer_settings__ vals_out, const ulli
 template<typename eT, typename T1>
 statslib_inline
 void
-rpois_mat_check(std::vector<eT>& X, const T1 dof_par)
+rpois_mat_check(std::vector<eT>& X, const T1 dof_par, const ullint_t seed_val)
+{
+    STDVEC_RAND_DIST_FN(rpois,dof_par,seed_val);
+}
+
+template<typename eT, typename T1, typename rngT>
+statslib_inline
+void
+rpois_mat_check(std::vector<eT>& X, const T1 dof_par, rngT& engine)
 {
-    STDVEC_RAND_DIST_FN(rpois,dof_par);
+    STDVEC_RAND_DIST_FN(rpois,dof_par,engine);
 }
 #endif
 
@@ -117,9 +320,17 @@ rpois_mat_check(std::vector<eT>& X, const T1 dof_par)
 template<typename mT, typename T1>
 statslib_inline
 void
-rpois_mat_check(mT& X, const T1 dof_par)
+rpois_mat_check(mT& X, const T1 dof_par, const ullint_t seed_val)
 {
-    MAIN_MAT_RAND_DIST_FN(rpois,dof_par);
+    MAIN_MAT_RAND_DIST_FN(rpois,dof_par,seed_val);
+}
+
+template<typename mT, typename T1, typename rngT>
+statslib_inline
+void
+rpois_mat_check(mT& X, const T1 dof_par, rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rpois,dof_par,engine);
 }
 #endif
 
@@ -131,6 +342,7 @@ rpois_mat_check(mT& X, const T1 dof_par)
  * @param n the number of output rows
  * @param k the number of output columns
  * @param rate_par the rate parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Poisson distribution.
  *
@@ -146,6 +358,8 @@ rpois_mat_check(mT& X, const T1 dof_par)
  * stats::rpois<Eigen::MatrixXd>(5,4,4);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -153,8 +367,46 @@ rpois_mat_check(mT& X, const T1 dof_par)
 template<typename mT, typename T1>
 statslib_inline
 mT
-rpois(const ullint_t n, const ullint_t k, const T1 rate_par)
+rpois(const ullint_t n, const ullint_t k, const T1 rate_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rpois_mat_check,rate_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Poisson distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param rate_par the rate parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Poisson distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rpois<std::vector<double>>(5,4,4,engine);
+ * // Armadillo matrix
+ * stats::rpois<arma::mat>(5,4,4,engine);
+ * // Blaze dynamic matrix
+ * stats::rpois<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,4,engine);
+ * // Eigen dynamic matrix
+ * stats::rpois<Eigen::MatrixXd>(5,4,4,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rpois(const ullint_t n, const ullint_t k, const T1 rate_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rpois_mat_check,rate_par);
+    GEN_MAT_RAND_FN(rpois_mat_check,rate_par,engine);
 }
 #endif
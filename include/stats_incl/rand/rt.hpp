@@ -28,15 +28,20 @@
 //
 // scalar output
 
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+return_t<T>
+rt(const T dof_par, rngT& engine);
+
 template<typename T>
 statslib_inline
 return_t<T>
-rt(const T dof_par, rand_engine_t& engine);
+rt(const T dof_par, const ullint_t seed_val);
 
 template<typename T>
 statslib_inline
 return_t<T>
-rt(const T dof_par, const ullint_t seed_val = std::random_device{}());
+rt(const T dof_par);
 
 //
 // vector/matrix output
@@ -45,7 +50,14 @@ rt(const T dof_par, const ullint_t seed_val = std::random_device{}());
 template<typename mT, typename T1>
 statslib_inline
 mT
-rt(const ullint_t n, const ullint_t k, const T1 dof_par);
+rt(const ullint_t n, const ullint_t k, const T1 dof_par,
+   const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rt(const ullint_t n, const ullint_t k, const T1 dof_par,
+   rngT& engine);
 #endif
 
 //
@@ -28,15 +28,19 @@
 namespace internal
 {
 
-template<typename T>
+template<typename T, typename rngT>
 statslib_inline
 T
-rt_compute(const T dof_par, rand_engine_t& engine)
+rt_compute(const T dof_par, rngT& engine)
 {
     if (!t_sanity_check(dof_par)) {
         return STLIM<T>::quiet_NaN();
     }
 
+    if (GCINT::is_posinf(dof_par)) {
+        return rnorm(T(0),T(1),engine);
+    }
+
     //
 
     T numer = rnorm(T(0),T(1),engine);
@@ -61,10 +65,10 @@ rt_compute(const T dof_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T>
+template<typename T, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 return_t<T>
-rt(const T dof_par, rand_engine_t& engine)
+rt(const T dof_par, rngT& engine)
 {
     return internal::rt_compute(static_cast<return_t<T>>(dof_par),engine);
 }
@@ -92,6 +96,29 @@ rt(const T dof_par, const ullint_t seed_val)
     return rt(dof_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the t-distribution
+ *
+ * @param dof_par the probability parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the t-distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rt(4);
+ * \endcode
+ */
+
+template<typename T>
+statslib_inline
+return_t<T>
+rt(const T dof_par)
+{
+    return rt(dof_par,internal::default_engine());
+}
+
 //
 // matrix output
 
@@ -99,12 +126,136 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+
+// Bailey's (1994) polar method: (u,v) uniform on the unit disc, w = u^2 + v^2, and
+// t = u * sqrt(dof * (w^(-2/dof) - 1) / w); one accepted pair (probability pi/4) per draw
+
+template<typename rngT>
+statslib_inline
+void
+rt_polar_draw(rngT& engine, double& u_out, double& w_out)
+{
+    // the open-interval draws map to non-zero values in (-1,1), so w > 0
+
+    double w_val;
+
+    do {
+        u_out = 2.0*rand_unif53_open(engine) - 1.0;
+        const double v_val = 2.0*rand_unif53_open(engine) - 1.0;
+
+        w_val = u_out*u_out + v_val*v_val;
+    } while (w_val >= 1.0);
+
+    w_out = w_val;
+}
+
+// the t draw from a polar pair, given r = -2 log(w) / dof and exp(r); exp(r) - 1 loses relative
+// accuracy for small r, where a degree-10 Taylor polynomial is used instead (truncation error
+// below 1e-17 for r < 0.1)
+
+statslib_inline
+double
+rt_polar_transform(const double u_val, const double w_val, const double r_val, const double exp_r_val, const double dof_par)
+{
+    double expm1_series = 1.0 / 3628800.0;
+    expm1_series = 1.0 / 362880.0 + r_val * expm1_series;
+    expm1_series = 1.0 / 40320.0 + r_val * expm1_series;
+    expm1_series = 1.0 / 5040.0 + r_val * expm1_series;
+    expm1_series = 1.0 / 720.0 + r_val * expm1_series;
+    expm1_series = 1.0 / 120.0 + r_val * expm1_series;
+    expm1_series = 1.0 / 24.0 + r_val * expm1_series;
+    expm1_series = 1.0 / 6.0 + r_val * expm1_series;
+    expm1_series = 0.5 + r_val * expm1_series;
+    expm1_series = r_val * (1.0 + r_val * expm1_series);
+
+    const double expm1_val = (r_val < 0.1) ? expm1_series : exp_r_val - 1.0;
+
+    return u_val * std::sqrt(dof_par * expm1_val / w_val);
+}
+
+// bulk fill: batches of polar pairs are drawn first, then w^(-2/dof) is computed for
+// the whole batch with the vectorized log and exp kernels
+
+template<typename T1, typename rngT, typename rT, typename TC = return_t<T1>>
+statslib_inline
+void
+rt_fill(const T1 dof_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC dof_par_c = static_cast<TC>(dof_par);
+
+    if (!t_sanity_check(dof_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    if (GCINT::is_posinf(dof_par_c)) {
+        rnorm_fill(TC(0),TC(1),engine,vals_out,num_elem);
+        return;
+    }
+
+    //
+
+    const double dof_d = static_cast<double>(dof_par_c);
+    const double pow_scale = - 2.0 / dof_d;
+
+    double u_vals[STATS_RAND_UNIF_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+    double w_vals[STATS_RAND_UNIF_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+    double r_vals[STATS_RAND_UNIF_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+    double exp_r_vals[STATS_RAND_UNIF_BATCH_SIZE + STATS_BATCH_MATH_WIDTH];
+
+    for (ullint_t j=ullint_t(0); j < num_elem; j += ullint_t(STATS_RAND_UNIF_BATCH_SIZE))
+    {
+        const ullint_t n_batch = std::min(ullint_t(STATS_RAND_UNIF_BATCH_SIZE), num_elem - j);
+        const ullint_t n_padded = (n_batch + STATS_BATCH_MATH_WIDTH - ullint_t(1)) / STATS_BATCH_MATH_WIDTH * STATS_BATCH_MATH_WIDTH;
+
+        for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+            rt_polar_draw(engine,u_vals[i],w_vals[i]);
+        }
+
+        for (ullint_t i=n_batch; i < n_padded; ++i) {
+            u_vals[i] = 0.0;
+            w_vals[i] = 0.5;
+        }
+
+        // r = -2 log(w) / dof > 0
+
+        for (ullint_t i=ullint_t(0); i < n_padded; ++i) {
+            r_vals[i] = w_vals[i];
+        }
+
+        batch_log(r_vals,n_padded);
+
+        for (ullint_t i=ullint_t(0); i < n_padded; ++i) {
+            r_vals[i] *= pow_scale;
+            exp_r_vals[i] = r_vals[i];
+        }
+
+        batch_exp(exp_r_vals,n_padded);
+
+        for (ullint_t i=ullint_t(0); i < n_batch; ++i) {
+            vals_out[j + i] = static_cast<rT>( rt_polar_transform(u_vals[i],w_vals[i],r_vals[i],exp_r_vals[i],dof_d) );
+        }
+    }
+}
+
 template<typename T1, typename rT>
 statslib_inline
 void
-rt_vec(const T1 dof_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rt_vec(const T1 dof_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rt_fill,vals_out,num_elem,seed_val,dof_par);
+}
+
+template<typename T1, typename rngT, typename rT>
+statslib_inline
+void
+rt_vec(const T1 dof_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rt,vals_out,num_elem,dof_par);
+    rt_fill(dof_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -112,9 +263,17 @@ rt_vec(const T1 dof_par, rT* __stats_pointer_settings__ vals_out, const ullint_t
 template<typename eT, typename T1>
 statslib_inline
 void
-rt_mat_check(std::vector<eT>& X, const T1 dof_par)
+rt_mat_check(std::vector<eT>& X, const T1 dof_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(rt,dof_par);
+    STDVEC_RAND_DIST_FN(rt,dof_par,seed_val);
+}
+
+template<typename eT, typename T1, typename rngT>
+statslib_inline
+void
+rt_mat_check(std::vector<eT>& X, const T1 dof_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rt,dof_par,engine);
 }
 #endif
 
@@ -122,9 +281,17 @@ rt_mat_check(std::vector<eT>& X, const T1 dof_par)
 template<typename mT, typename T1>
 statslib_inline
 void
-rt_mat_check(mT& X, const T1 dof_par)
+rt_mat_check(mT& X, const T1 dof_par, const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rt,dof_par,seed_val);
+}
+
+template<typename mT, typename T1, typename rngT>
+statslib_inline
+void
+rt_mat_check(mT& X, const T1 dof_par, rngT& engine)
 {
-    MAIN_MAT_RAND_DIST_FN(rt,dof_par);
+    MAIN_MAT_RAND_DIST_FN(rt,dof_par,engine);
 }
 #endif
 
@@ -136,6 +303,7 @@ rt_mat_check(mT& X, const T1 dof_par)
  * @param n the number of output rows
  * @param k the number of output columns
  * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the t-distribution.
  *
@@ -151,6 +319,8 @@ rt_mat_check(mT& X, const T1 dof_par)
  * stats::rt<Eigen::MatrixXd>(5,4,12);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -158,8 +328,46 @@ rt_mat_check(mT& X, const T1 dof_par)
 template<typename mT, typename T1>
 statslib_inline
 mT
-rt(const ullint_t n, const ullint_t k, const T1 dof_par)
+rt(const ullint_t n, const ullint_t k, const T1 dof_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rt_mat_check,dof_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the t-distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param dof_par the degrees of freedom parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the t-distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rt<std::vector<double>>(5,4,12,engine);
+ * // Armadillo matrix
+ * stats::rt<arma::mat>(5,4,12,engine);
+ * // Blaze dynamic matrix
+ * stats::rt<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,12,engine);
+ * // Eigen dynamic matrix
+ * stats::rt<Eigen::MatrixXd>(5,4,12,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rt(const ullint_t n, const ullint_t k, const T1 dof_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rt_mat_check,dof_par);
+    GEN_MAT_RAND_FN(rt_mat_check,dof_par,engine);
 }
 #endif
@@ -0,0 +1,68 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/* 
+ * Sample from a truncated Normal distribution
+ */
+
+#ifndef _statslib_rtnorm_HPP
+#define _statslib_rtnorm_HPP
+
+//
+// scalar output
+
+template<typename T1, typename T2, typename T3, typename T4, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+common_return_t<T1,T2,T3,T4>
+rtnorm(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par, rngT& engine);
+
+template<typename T1, typename T2, typename T3, typename T4>
+statslib_inline
+common_return_t<T1,T2,T3,T4>
+rtnorm(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par, const ullint_t seed_val);
+
+template<typename T1, typename T2, typename T3, typename T4>
+statslib_inline
+common_return_t<T1,T2,T3,T4>
+rtnorm(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par);
+
+//
+// vector/matrix output
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename T3, typename T4>
+statslib_inline
+mT
+rtnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+       const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename T2, typename T3, typename T4, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rtnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+       rngT& engine);
+#endif
+
+//
+// include implementation files
+
+#include "rtnorm.ipp"
+
+#endif
@@ -0,0 +1,437 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sample from a truncated Normal distribution
+ */
+
+//
+// scalar output
+
+namespace internal
+{
+
+// Accept-reject samplers of Robert (1995) for a standard Normal restricted to [a,b].
+// An interval entirely below zero is reflected, so that either a < 0 < b or a >= 0;
+// the proposal (normal, half-normal, uniform, or translated exponential with the
+// optimal rate) is the one with the highest acceptance rate for the given interval.
+// Choosing the proposal depends only on (a,b), so this is done once for repeated draws.
+
+#ifndef STATS_RTNORM_HALFNORM_CUTOFF
+    #define STATS_RTNORM_HALFNORM_CUTOFF 0.25696 // half-normal proposals beat exponential ones for a below this value
+#endif
+
+struct rtnorm_pars
+{
+    enum method_t { normal_prop, halfnorm_prop, unif_prop, exp_prop };
+
+    method_t method;
+    bool flip;       // draws are negated before rescaling
+
+    double a;        // standardized (and possibly reflected) bounds
+    double b;
+    double mode;     // mode of the target density on [a,b], for uniform proposals
+    double rate;     // rate of the exponential proposal
+
+    explicit rtnorm_pars(const double a_std, const double b_std)
+        : method(normal_prop),
+          flip(b_std <= 0.0),
+          a(flip ? - b_std : a_std),
+          b(flip ? - a_std : b_std),
+          mode(a < 0.0 ? 0.0 : a),
+          rate(0.0)
+    {
+        if (a < 0.0)
+        {
+            // the interval contains zero; uniform proposals win if b - a < sqrt(2 pi)
+            method = (b - a < 2.5066282746310002) ? unif_prop : normal_prop;
+        }
+        else if (a < STATS_RTNORM_HALFNORM_CUTOFF)
+        {
+            // half-normal proposals win if b - a > sqrt(pi/2) exp(a^2/2)
+            method = (b - a > 1.2533141373155003 * std::exp(0.5*a*a)) ? halfnorm_prop : unif_prop;
+        }
+        else
+        {
+            // exponential proposals win beyond the bound of Robert (1995); a^2 is
+            // avoided so that the rate stays finite for very large a
+
+            const double sqrt_term = (a > 1.0) ? a * std::sqrt(1.0 + (4.0/a)/a) : std::sqrt(a*a + 4.0);
+            const double b_lim = a + 2.0 * 1.6487212707001282 / (a + sqrt_term) * std::exp(- a / (a + sqrt_term));
+
+            rate = 0.5 * (a + sqrt_term);
+            method = (b <= b_lim) ? unif_prop : exp_prop;
+        }
+    }
+};
+
+template<typename rngT>
+statslib_inline
+double
+rtnorm_std_draw(const rtnorm_pars& pars, const rnorm_zig_tables& zig_tables, rngT& engine)
+{
+    double z = 0.0;
+
+    switch (pars.method)
+    {
+        case rtnorm_pars::normal_prop:
+            do {
+                z = rnorm_zig_draw(zig_tables,engine);
+            } while (z < pars.a || z > pars.b);
+            break;
+
+        case rtnorm_pars::halfnorm_prop:
+            do {
+                z = std::abs(rnorm_zig_draw(zig_tables,engine));
+            } while (z < pars.a || z > pars.b);
+            break;
+
+        case rtnorm_pars::unif_prop:
+            while (true)
+            {
+                z = pars.a + (pars.b - pars.a) * rand_unif53(engine);
+
+                if (rand_unif53(engine) <= std::exp(0.5 * (pars.mode - z) * (pars.mode + z))) {
+                    break;
+                }
+            }
+            break;
+
+        case rtnorm_pars::exp_prop:
+            while (true)
+            {
+                z = pars.a - std::log(rand_unif53_open(engine)) / pars.rate;
+
+                if (z > pars.b) {
+                    continue;
+                }
+
+                const double z_diff = z - pars.rate;
+
+                if (- 2.0 * std::log(rand_unif53_open(engine)) >= z_diff * z_diff) {
+                    break;
+                }
+            }
+            break;
+    }
+
+    return pars.flip ? - z : z;
+}
+
+template<typename T>
+statslib_inline
+T
+rtnorm_rescale(const double z, const T mu_par, const T sigma_par, const T lower_par, const T upper_par)
+{
+    // guard against rounding outside of the support
+    return std::min(std::max(mu_par + sigma_par*static_cast<T>(z), lower_par), upper_par);
+}
+
+template<typename T, typename rngT>
+statslib_inline
+T
+rtnorm_compute(const T mu_par, const T sigma_par, const T lower_par, const T upper_par, rngT& engine)
+{
+    if (!tnorm_sanity_check(mu_par,sigma_par,lower_par,upper_par)) {
+        return STLIM<T>::quiet_NaN();
+    }
+
+    //
+
+    const rtnorm_pars pars(static_cast<double>((lower_par - mu_par) / sigma_par),
+                           static_cast<double>((upper_par - mu_par) / sigma_par));
+
+    return rtnorm_rescale(rtnorm_std_draw(pars,rnorm_zig_get_tables(),engine),mu_par,sigma_par,lower_par,upper_par);
+}
+
+template<typename T1, typename T2, typename T3, typename T4, typename rngT, typename TC = common_return_t<T1,T2,T3,T4>>
+statslib_inline
+TC
+rtnorm_type_check(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par, rngT& engine)
+{
+    return rtnorm_compute(static_cast<TC>(mu_par),static_cast<TC>(sigma_par),
+                          static_cast<TC>(lower_par),static_cast<TC>(upper_par),engine);
+}
+
+}
+
+/**
+ * @brief Random sampling function for the truncated Normal distribution
+ *
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw from the Normal distribution, conditional on lying in <tt>[lower_par, upper_par]</tt>.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * stats::rtnorm(1.0,2.0,0.0,3.0,engine);
+ * \endcode
+ *
+ * @note The draw is exact in the far tails: no CDF or quantile function is evaluated.
+ */
+
+template<typename T1, typename T2, typename T3, typename T4, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+common_return_t<T1,T2,T3,T4>
+rtnorm(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par, rngT& engine)
+{
+    return internal::rtnorm_type_check(mu_par,sigma_par,lower_par,upper_par,engine);
+}
+
+/**
+ * @brief Random sampling function for the truncated Normal distribution
+ *
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
+ *
+ * @return a pseudo-random draw from the Normal distribution, conditional on lying in <tt>[lower_par, upper_par]</tt>.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rtnorm(1.0,2.0,0.0,3.0,1776);
+ * \endcode
+ */
+
+template<typename T1, typename T2, typename T3, typename T4>
+statslib_inline
+common_return_t<T1,T2,T3,T4>
+rtnorm(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par, const ullint_t seed_val)
+{
+    rand_engine_t engine(seed_val);
+    return rtnorm(mu_par,sigma_par,lower_par,upper_par,engine);
+}
+
+/**
+ * @brief Random sampling function for the truncated Normal distribution
+ *
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ *
+ * @return a pseudo-random draw from the Normal distribution, conditional on lying in <tt>[lower_par, upper_par]</tt>.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rtnorm(1.0,2.0,0.0,3.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2, typename T3, typename T4>
+statslib_inline
+common_return_t<T1,T2,T3,T4>
+rtnorm(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par)
+{
+    return rtnorm(mu_par,sigma_par,lower_par,upper_par,internal::default_engine());
+}
+
+//
+// vector/matrix output
+
+namespace internal
+{
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+// bulk fill: the sanity check and the choice of proposal are done once for all draws
+
+template<typename T1, typename T2, typename T3, typename T4, typename rngT, typename rT, typename TC = common_return_t<T1,T2,T3,T4>>
+statslib_inline
+void
+rtnorm_fill(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+            rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC mu_par_c = static_cast<TC>(mu_par);
+    const TC sigma_par_c = static_cast<TC>(sigma_par);
+    const TC lower_par_c = static_cast<TC>(lower_par);
+    const TC upper_par_c = static_cast<TC>(upper_par);
+
+    if (!tnorm_sanity_check(mu_par_c,sigma_par_c,lower_par_c,upper_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    const rtnorm_pars pars(static_cast<double>((lower_par_c - mu_par_c) / sigma_par_c),
+                           static_cast<double>((upper_par_c - mu_par_c) / sigma_par_c));
+
+    const rnorm_zig_tables& zig_tables = rnorm_zig_get_tables();
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = static_cast<rT>(rtnorm_rescale(rtnorm_std_draw(pars,zig_tables,engine),mu_par_c,sigma_par_c,lower_par_c,upper_par_c));
+    }
+}
+
+template<typename T1, typename T2, typename T3, typename T4, typename rT>
+statslib_inline
+void
+rtnorm_vec(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+           const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rtnorm_fill,vals_out,num_elem,seed_val,mu_par,sigma_par,lower_par,upper_par);
+}
+
+template<typename T1, typename T2, typename T3, typename T4, typename rngT, typename rT>
+statslib_inline
+void
+rtnorm_vec(const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+           rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    rtnorm_fill(mu_par,sigma_par,lower_par,upper_par,engine,vals_out,num_elem);
+}
+#endif
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename T1, typename T2, typename T3, typename T4>
+statslib_inline
+void
+rtnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+                 const ullint_t seed_val)
+{
+    STDVEC_RAND_DIST_FN(rtnorm,mu_par,sigma_par,lower_par,upper_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename T3, typename T4, typename rngT>
+statslib_inline
+void
+rtnorm_mat_check(std::vector<eT>& X, const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+                 rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rtnorm,mu_par,sigma_par,lower_par,upper_par,engine);
+}
+#endif
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+template<typename mT, typename T1, typename T2, typename T3, typename T4>
+statslib_inline
+void
+rtnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+                 const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rtnorm,mu_par,sigma_par,lower_par,upper_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename T3, typename T4, typename rngT>
+statslib_inline
+void
+rtnorm_mat_check(mT& X, const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+                 rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rtnorm,mu_par,sigma_par,lower_par,upper_par,engine);
+}
+#endif
+
+}
+
+/**
+ * @brief Random matrix sampling function for the truncated Normal distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
+ *
+ * @return a matrix of pseudo-random draws from the truncated Normal distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * // std::vector
+ * stats::rtnorm<std::vector<double>>(5,4,1.0,2.0,0.0,3.0);
+ * // Armadillo matrix
+ * stats::rtnorm<arma::mat>(5,4,1.0,2.0,0.0,3.0);
+ * // Blaze dynamic matrix
+ * stats::rtnorm<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,1.0,2.0,0.0,3.0);
+ * // Eigen dynamic matrix
+ * stats::rtnorm<Eigen::MatrixXd>(5,4,1.0,2.0,0.0,3.0);
+ * \endcode
+ *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename T3, typename T4>
+statslib_inline
+mT
+rtnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+       const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rtnorm_mat_check,mu_par,sigma_par,lower_par,upper_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the truncated Normal distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param mu_par the mean parameter, a real-valued input.
+ * @param sigma_par the standard deviation parameter, a real-valued input.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the truncated Normal distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rtnorm<std::vector<double>>(5,4,1.0,2.0,0.0,3.0,engine);
+ * // Armadillo matrix
+ * stats::rtnorm<arma::mat>(5,4,1.0,2.0,0.0,3.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rtnorm<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,1.0,2.0,0.0,3.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rtnorm<Eigen::MatrixXd>(5,4,1.0,2.0,0.0,3.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename T3, typename T4, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rtnorm(const ullint_t n, const ullint_t k, const T1 mu_par, const T2 sigma_par, const T3 lower_par, const T4 upper_par,
+       rngT& engine)
+{
+    GEN_MAT_RAND_FN(rtnorm_mat_check,mu_par,sigma_par,lower_par,upper_par,engine);
+}
+#endif
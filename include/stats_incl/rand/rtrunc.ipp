@@ -0,0 +1,379 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+/*
+ * Sample from a truncated distribution by inversion
+ */
+
+//
+// scalar output
+
+namespace internal
+{
+
+// a distribution with CDF F and quantile function Q, restricted to [lower, upper], is sampled
+// as Q(F(lower-) + (F(upper) - F(lower-)) u), with u uniform on (0,1); the probabilities of the
+// bounds depend only on the truncation points, so are computed once for repeated draws.
+// F(lower-), the left limit of F at lower, is taken as F at the next representable value below
+// lower: this keeps any point mass at lower (discrete support), and is F(lower) to within
+// rounding for a continuous distribution
+
+template<typename T, typename cdfT>
+statslib_inline
+T
+rtrunc_cdf_left_limit(const cdfT& cdf_fn, const T lower_par)
+{
+    return static_cast<T>(cdf_fn(std::nextafter(lower_par,-STLIM<T>::infinity())));
+}
+
+template<typename T>
+statslib_inline
+bool
+rtrunc_sanity_check(const T lower_par, const T upper_par, const T p_lower, const T p_upper)
+{
+    return( GCINT::any_nan(lower_par,upper_par) ? \
+                false :
+            //
+            lower_par >= upper_par ? \
+                false :
+            // also catches a NaN-valued CDF, and intervals with no mass at this precision
+            !(p_lower < p_upper) ? \
+                false :
+            //
+                true );
+}
+
+template<typename T, typename quantT>
+statslib_inline
+T
+rtrunc_unif_transform(const T u, const quantT& quant_fn, const T lower_par, const T upper_par, const T p_lower, const T p_upper)
+{
+    const T quant_val = static_cast<T>(quant_fn(p_lower + (p_upper - p_lower) * u));
+
+    // guard against the quantile function rounding outside of the support
+    return std::min(std::max(quant_val, lower_par), upper_par);
+}
+
+template<typename T, typename cdfT, typename quantT, typename rngT>
+statslib_inline
+T
+rtrunc_compute(const cdfT& cdf_fn, const quantT& quant_fn, const T lower_par, const T upper_par, rngT& engine)
+{
+    if (GCINT::any_nan(lower_par,upper_par)) {
+        return STLIM<T>::quiet_NaN();
+    }
+
+    const T p_lower = rtrunc_cdf_left_limit(cdf_fn,lower_par);
+    const T p_upper = static_cast<T>(cdf_fn(upper_par));
+
+    if (!rtrunc_sanity_check(lower_par,upper_par,p_lower,p_upper)) {
+        return STLIM<T>::quiet_NaN();
+    }
+
+    //
+
+    return rtrunc_unif_transform(rand_unif_open<T>(engine),quant_fn,lower_par,upper_par,p_lower,p_upper);
+}
+
+template<typename T1, typename T2, typename cdfT, typename quantT, typename rngT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+TC
+rtrunc_type_check(const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par, rngT& engine)
+{
+    return rtrunc_compute(cdf_fn,quant_fn,static_cast<TC>(lower_par),static_cast<TC>(upper_par),engine);
+}
+
+}
+
+/**
+ * @brief Random sampling function for a truncated distribution
+ *
+ * @param cdf_fn the distribution function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param quant_fn the quantile function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a pseudo-random draw from the distribution, conditional on lying in <tt>[lower_par, upper_par]</tt>.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // Gamma(2,1) truncated to [1,3]
+ * stats::rtrunc([](double x) { return stats::pgamma(x,2.0,1.0); },
+ *               [](double p) { return stats::qgamma(p,2.0,1.0); },
+ *               1.0,3.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated by inversion, so their accuracy is limited by that of \c cdf_fn and \c quant_fn.
+ * The lower bound is evaluated as <tt>cdf_fn(std::nextafter(lower_par,-Inf))</tt>, so that a point mass at \c lower_par
+ * is kept; for a discrete distribution, \c cdf_fn should therefore round its argument down (e.g., with \c std::floor).
+ * When the truncation interval lies far in the upper tail, <tt>cdf_fn(lower_par)</tt> is close to one and precision is lost;
+ * for the Normal distribution, use \c rtnorm, which is exact in both tails.
+ */
+
+template<typename T1, typename T2, typename cdfT, typename quantT, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+common_return_t<T1,T2>
+rtrunc(const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par, rngT& engine)
+{
+    return internal::rtrunc_type_check(cdf_fn,quant_fn,lower_par,upper_par,engine);
+}
+
+/**
+ * @brief Random sampling function for a truncated distribution
+ *
+ * @param cdf_fn the distribution function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param quant_fn the quantile function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
+ *
+ * @return a pseudo-random draw from the distribution, conditional on lying in <tt>[lower_par, upper_par]</tt>.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rtrunc([](double x) { return stats::pgamma(x,2.0,1.0); },
+ *               [](double p) { return stats::qgamma(p,2.0,1.0); },
+ *               1.0,3.0,1776);
+ * \endcode
+ */
+
+template<typename T1, typename T2, typename cdfT, typename quantT>
+statslib_inline
+common_return_t<T1,T2>
+rtrunc(const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par, const ullint_t seed_val)
+{
+    rand_engine_t engine(seed_val);
+    return rtrunc(cdf_fn,quant_fn,lower_par,upper_par,engine);
+}
+
+/**
+ * @brief Random sampling function for a truncated distribution
+ *
+ * @param cdf_fn the distribution function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param quant_fn the quantile function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ *
+ * @return a pseudo-random draw from the distribution, conditional on lying in <tt>[lower_par, upper_par]</tt>.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rtrunc([](double x) { return stats::pgamma(x,2.0,1.0); },
+ *               [](double p) { return stats::qgamma(p,2.0,1.0); },
+ *               1.0,3.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2, typename cdfT, typename quantT>
+statslib_inline
+common_return_t<T1,T2>
+rtrunc(const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par)
+{
+    return rtrunc(cdf_fn,quant_fn,lower_par,upper_par,internal::default_engine());
+}
+
+//
+// vector/matrix output
+
+namespace internal
+{
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+// bulk fill: the distribution function is evaluated at the truncation points once for all draws
+
+template<typename T1, typename T2, typename cdfT, typename quantT, typename rngT, typename rT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+void
+rtrunc_fill(const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+            rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC lower_par_c = static_cast<TC>(lower_par);
+    const TC upper_par_c = static_cast<TC>(upper_par);
+
+    const TC p_lower = GCINT::is_nan(lower_par_c) ? lower_par_c : rtrunc_cdf_left_limit(cdf_fn,lower_par_c);
+    const TC p_upper = GCINT::is_nan(upper_par_c) ? upper_par_c : static_cast<TC>(cdf_fn(upper_par_c));
+
+    if (!rtrunc_sanity_check(lower_par_c,upper_par_c,p_lower,p_upper))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    for (ullint_t j=ullint_t(0); j < num_elem; ++j)
+    {
+        vals_out[j] = static_cast<rT>(rtrunc_unif_transform(rand_unif_open<TC>(engine),quant_fn,lower_par_c,upper_par_c,p_lower,p_upper));
+    }
+}
+
+template<typename T1, typename T2, typename cdfT, typename quantT, typename rT>
+statslib_inline
+void
+rtrunc_vec(const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+           const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(rtrunc_fill,vals_out,num_elem,seed_val,cdf_fn,quant_fn,lower_par,upper_par);
+}
+
+template<typename T1, typename T2, typename cdfT, typename quantT, typename rngT, typename rT>
+statslib_inline
+void
+rtrunc_vec(const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+           rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    rtrunc_fill(cdf_fn,quant_fn,lower_par,upper_par,engine,vals_out,num_elem);
+}
+#endif
+
+#ifdef STATS_ENABLE_STDVEC_WRAPPERS
+template<typename eT, typename T1, typename T2, typename cdfT, typename quantT>
+statslib_inline
+void
+rtrunc_mat_check(std::vector<eT>& X, const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+                 const ullint_t seed_val)
+{
+    STDVEC_RAND_DIST_FN(rtrunc,cdf_fn,quant_fn,lower_par,upper_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename cdfT, typename quantT, typename rngT>
+statslib_inline
+void
+rtrunc_mat_check(std::vector<eT>& X, const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+                 rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(rtrunc,cdf_fn,quant_fn,lower_par,upper_par,engine);
+}
+#endif
+
+#ifdef STATS_ENABLE_MATRIX_FEATURES
+template<typename mT, typename T1, typename T2, typename cdfT, typename quantT>
+statslib_inline
+void
+rtrunc_mat_check(mT& X, const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+                 const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rtrunc,cdf_fn,quant_fn,lower_par,upper_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename cdfT, typename quantT, typename rngT>
+statslib_inline
+void
+rtrunc_mat_check(mT& X, const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+                 rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(rtrunc,cdf_fn,quant_fn,lower_par,upper_par,engine);
+}
+#endif
+
+}
+
+/**
+ * @brief Random matrix sampling function for a truncated distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param cdf_fn the distribution function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param quant_fn the quantile function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
+ *
+ * @return a matrix of pseudo-random draws from the truncated distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto cdf_fn = [](double x) { return stats::pgamma(x,2.0,1.0); };
+ * auto quant_fn = [](double p) { return stats::qgamma(p,2.0,1.0); };
+ * // std::vector
+ * stats::rtrunc<std::vector<double>>(5,4,cdf_fn,quant_fn,1.0,3.0);
+ * // Armadillo matrix
+ * stats::rtrunc<arma::mat>(5,4,cdf_fn,quant_fn,1.0,3.0);
+ * // Blaze dynamic matrix
+ * stats::rtrunc<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,cdf_fn,quant_fn,1.0,3.0);
+ * // Eigen dynamic matrix
+ * stats::rtrunc<Eigen::MatrixXd>(5,4,cdf_fn,quant_fn,1.0,3.0);
+ * \endcode
+ *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used;
+ * \c cdf_fn and \c quant_fn may then be called concurrently, and so must be safe to do so.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename cdfT, typename quantT>
+statslib_inline
+mT
+rtrunc(const ullint_t n, const ullint_t k, const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+       const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rtrunc_mat_check,cdf_fn,quant_fn,lower_par,upper_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for a truncated distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param cdf_fn the distribution function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param quant_fn the quantile function of the untruncated distribution, a callable object taking and returning a real value.
+ * @param lower_par the lower truncation point, a real-valued input (possibly \c -Inf).
+ * @param upper_par the upper truncation point, a real-valued input (possibly \c +Inf).
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the truncated distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * auto cdf_fn = [](double x) { return stats::pgamma(x,2.0,1.0); };
+ * auto quant_fn = [](double p) { return stats::qgamma(p,2.0,1.0); };
+ * // std::vector
+ * stats::rtrunc<std::vector<double>>(5,4,cdf_fn,quant_fn,1.0,3.0,engine);
+ * // Armadillo matrix
+ * stats::rtrunc<arma::mat>(5,4,cdf_fn,quant_fn,1.0,3.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rtrunc<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,cdf_fn,quant_fn,1.0,3.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rtrunc<Eigen::MatrixXd>(5,4,cdf_fn,quant_fn,1.0,3.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename cdfT, typename quantT, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rtrunc(const ullint_t n, const ullint_t k, const cdfT& cdf_fn, const quantT& quant_fn, const T1 lower_par, const T2 upper_par,
+       rngT& engine)
+{
+    GEN_MAT_RAND_FN(rtrunc_mat_check,cdf_fn,quant_fn,lower_par,upper_par,engine);
+}
+#endif
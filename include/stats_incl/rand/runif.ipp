@@ -28,27 +28,40 @@
 namespace internal
 {
 
+// map a draw from (0,1) to (a,b); rounding can only reach an end point when b - a is small
+// relative to |a| or |b|, in which case the result is moved to the nearest interior value
+
 template<typename T>
 statslib_inline
 T
-runif_compute(const T a_par, const T b_par, rand_engine_t& engine)
+runif_unif_transform(const T u, const T a_par, const T b_par)
+{
+    const T x = a_par + (b_par - a_par)*u;
+
+    return( x <= a_par ? \
+                std::nextafter(a_par,b_par) :
+            x >= b_par ? \
+                std::nextafter(b_par,a_par) :
+            //
+                x );
+}
+
+template<typename T, typename rngT>
+statslib_inline
+T
+runif_compute(const T a_par, const T b_par, rngT& engine)
 {
     if (!unif_sanity_check(a_par,b_par)) {
         return STLIM<T>::quiet_NaN();
     }
-    
-    // convert from [a,b) to (a,b)
-
-    T a_par_adj = std::nextafter(a_par, b_par);
-    std::uniform_real_distribution<T> unif_dist(a_par_adj, b_par);
 
-    return unif_dist(engine);
+    return runif_unif_transform(rand_unif_open<T>(engine),a_par,b_par);
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_inline
 TC
-runif_type_check(const T1 a_par, const T2 b_par, rand_engine_t& engine)
+runif_type_check(const T1 a_par, const T2 b_par, rngT& engine)
 {
     return runif_compute(static_cast<TC>(a_par),static_cast<TC>(b_par),engine);
 }
@@ -71,10 +84,10 @@ runif_type_check(const T1 a_par, const T2 b_par, rand_engine_t& engine)
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2> 
-runif(const T1 a_par, const T2 b_par, rand_engine_t& engine)
+runif(const T1 a_par, const T2 b_par, rngT& engine)
 {
     return internal::runif_type_check(a_par,b_par,engine);
 }
@@ -103,6 +116,30 @@ runif(const T1 a_par, const T2 b_par, const ullint_t seed_val)
     return runif(a_par,b_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Uniform distribution
+ *
+ * @param a_par a real-valued shape parameter.
+ * @param b_par a real-valued shape parameter.
+ *
+ * @return a pseudo-random draw from the Uniform distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::runif(3.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2> 
+runif(const T1 a_par, const T2 b_par)
+{
+    return runif(a_par,b_par,internal::default_engine());
+}
+
 /**
  * @brief Random sampling function for the Uniform distribution on the unit interval
  *
@@ -129,12 +166,48 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+// bulk fill: the sanity check is done once, and uniforms are generated and transformed in batches
+
+template<typename T1, typename T2, typename rngT, typename rT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+void
+runif_fill(const T1 a_par, const T2 b_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC a_par_c = static_cast<TC>(a_par);
+    const TC b_par_c = static_cast<TC>(b_par);
+
+    if (!unif_sanity_check(a_par_c,b_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    rand_unif_batch_fill<TC>(engine,vals_out,num_elem,
+        [=](double* vals, const ullint_t n_vals)
+        {
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = static_cast<double>(runif_unif_transform(static_cast<TC>(vals[j]),a_par_c,b_par_c));
+            }
+        });
+}
+
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-runif_vec(const T1 a_par, const T2 b_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+runif_vec(const T1 a_par, const T2 b_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    RAND_DIST_FN_VEC_FILL(runif_fill,vals_out,num_elem,seed_val,a_par,b_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+runif_vec(const T1 a_par, const T2 b_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(runif,vals_out,num_elem,a_par,b_par);
+    runif_fill(a_par,b_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -142,9 +215,17 @@ runif_vec(const T1 a_par, const T2 b_par, rT* __stats_pointer_settings__ vals_ou
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-runif_mat_check(std::vector<eT>& X, const T1 a_par, const T2 b_par)
+runif_mat_check(std::vector<eT>& X, const T1 a_par, const T2 b_par, const ullint_t seed_val)
 {
-    STDVEC_RAND_DIST_FN(runif,a_par,b_par);
+    STDVEC_RAND_DIST_FN(runif,a_par,b_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+runif_mat_check(std::vector<eT>& X, const T1 a_par, const T2 b_par, rngT& engine)
+{
+    STDVEC_RAND_DIST_FN(runif,a_par,b_par,engine);
 }
 #endif
 
@@ -152,9 +233,17 @@ runif_mat_check(std::vector<eT>& X, const T1 a_par, const T2 b_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-runif_mat_check(mT& X, const T1 a_par, const T2 b_par)
+runif_mat_check(mT& X, const T1 a_par, const T2 b_par, const ullint_t seed_val)
 {
-    MAIN_MAT_RAND_DIST_FN(runif,a_par,b_par);
+    MAIN_MAT_RAND_DIST_FN(runif,a_par,b_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+runif_mat_check(mT& X, const T1 a_par, const T2 b_par, rngT& engine)
+{
+    MAIN_MAT_RAND_DIST_FN(runif,a_par,b_par,engine);
 }
 #endif
 
@@ -167,6 +256,7 @@ runif_mat_check(mT& X, const T1 a_par, const T2 b_par)
  * @param k the number of output columns
  * @param a_par a real-valued shape parameter.
  * @param b_par a real-valued shape parameter.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Uniform distribution.
  *
@@ -182,6 +272,8 @@ runif_mat_check(mT& X, const T1 a_par, const T2 b_par)
  * stats::runif<Eigen::MatrixXd>(5,4,-1.0,3.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -189,8 +281,47 @@ runif_mat_check(mT& X, const T1 a_par, const T2 b_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par)
+runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(runif_mat_check,a_par,b_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Uniform distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param a_par a real-valued shape parameter.
+ * @param b_par a real-valued shape parameter.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Uniform distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::runif<std::vector<double>>(5,4,-1.0,3.0,engine);
+ * // Armadillo matrix
+ * stats::runif<arma::mat>(5,4,-1.0,3.0,engine);
+ * // Blaze dynamic matrix
+ * stats::runif<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,-1.0,3.0,engine);
+ * // Eigen dynamic matrix
+ * stats::runif<Eigen::MatrixXd>(5,4,-1.0,3.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+runif(const ullint_t n, const ullint_t k, const T1 a_par, const T2 b_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(runif_mat_check,a_par,b_par);
+    GEN_MAT_RAND_FN(runif_mat_check,a_par,b_par,engine);
 }
 #endif
@@ -28,15 +28,20 @@
 //
 // scalar output
 
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+common_return_t<T1,T2>
+rweibull(const T1 shape_par, const T2 scale_par, rngT& engine);
+
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rweibull(const T1 shape_par, const T2 scale_par, rand_engine_t& engine);
+rweibull(const T1 shape_par, const T2 scale_par, const ullint_t seed_val);
 
 template<typename T1, typename T2>
 statslib_inline
 common_return_t<T1,T2>
-rweibull(const T1 shape_par, const T2 scale_par, const ullint_t seed_val = std::random_device{}());
+rweibull(const T1 shape_par, const T2 scale_par);
 
 //
 // vector/matrix output
@@ -45,7 +50,14 @@ rweibull(const T1 shape_par, const T2 scale_par, const ullint_t seed_val = std::
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par);
+rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par,
+         const ullint_t seed_val = internal::default_seed());
+
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT
+rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par,
+         rngT& engine);
 #endif
 
 //
@@ -28,21 +28,32 @@
 namespace internal
 {
 
+// map a draw from (0,1) to a Weibull draw; -log(u) replaces -log(1 - u) in the quantile
+// function, which has the same distribution
+
 template<typename T>
 statslib_inline
 T
-rweibull_compute(const T shape_par, const T scale_par, rand_engine_t& engine)
+rweibull_unif_transform(const T u, const T inv_shape_par, const T scale_par)
+{
+    return( scale_par*std::pow(- std::log(u), inv_shape_par) );
+}
+
+template<typename T, typename rngT>
+statslib_inline
+T
+rweibull_compute(const T shape_par, const T scale_par, rngT& engine)
 {
     return( !weibull_sanity_check(shape_par,scale_par) ? \
                 STLIM<T>::quiet_NaN() :
             //
-            qweibull(runif(T(0),T(1),engine),shape_par,scale_par) );
+            rweibull_unif_transform(rand_unif_open<T>(engine),T(1)/shape_par,scale_par) );
 }
 
-template<typename T1, typename T2, typename TC = common_return_t<T1,T2>>
+template<typename T1, typename T2, typename rngT, typename TC = common_return_t<T1,T2>>
 statslib_constexpr
 TC
-rweibull_type_check(const T1 shape_par, const T2 scale_par, rand_engine_t& engine)
+rweibull_type_check(const T1 shape_par, const T2 scale_par, rngT& engine)
 noexcept
 {
     return rweibull_compute(static_cast<TC>(shape_par),static_cast<TC>(scale_par),engine);
@@ -66,10 +77,10 @@ noexcept
  * \endcode
  */
 
-template<typename T1, typename T2>
+template<typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 common_return_t<T1,T2>
-rweibull(const T1 shape_par, const T2 scale_par, rand_engine_t& engine)
+rweibull(const T1 shape_par, const T2 scale_par, rngT& engine)
 {
     return internal::rweibull_type_check(shape_par,scale_par,engine);
 }
@@ -98,6 +109,30 @@ rweibull(const T1 shape_par, const T2 scale_par, const ullint_t seed_val)
     return rweibull(shape_par,scale_par,engine);
 }
 
+/**
+ * @brief Random sampling function for the Weibull distribution
+ *
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ *
+ * @return a pseudo-random draw from the Weibull distribution.
+ *
+ * Draws are taken from the default engine of the calling thread; see \c stats::set_seed.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rweibull(3.0,2.0);
+ * \endcode
+ */
+
+template<typename T1, typename T2>
+statslib_inline
+common_return_t<T1,T2>
+rweibull(const T1 shape_par, const T2 scale_par)
+{
+    return rweibull(shape_par,scale_par,internal::default_engine());
+}
+
 //
 // vector/matrix output
 
@@ -105,12 +140,70 @@ namespace internal
 {
 
 #ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+// bulk fill: the sanity check is done once, and uniforms are generated and transformed in batches
+
+template<typename T1, typename T2, typename rngT, typename rT, typename TC = common_return_t<T1,T2>>
+statslib_inline
+void
+rweibull_fill(const T1 shape_par, const T2 scale_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    const TC shape_par_c = static_cast<TC>(shape_par);
+    const TC scale_par_c = static_cast<TC>(scale_par);
+
+    if (!weibull_sanity_check(shape_par_c,scale_par_c))
+    {
+        for (ullint_t j=ullint_t(0); j < num_elem; ++j) {
+            vals_out[j] = static_cast<rT>(STLIM<TC>::quiet_NaN());
+        }
+
+        return;
+    }
+
+    const double inv_shape_par_d = 1.0 / static_cast<double>(shape_par_c);
+    const double scale_par_d = static_cast<double>(scale_par_c);
+
+    rand_unif_batch_fill<TC>(engine,vals_out,num_elem,
+        [=](double* vals, const ullint_t n_vals)
+        {
+            // scale * exp(log(-log(u)) / shape); the outer log and exp are skipped when shape = 1
+
+            batch_log(vals,n_vals);
+
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] = - vals[j];
+            }
+
+            if (inv_shape_par_d != 1.0)
+            {
+                batch_log(vals,n_vals);
+
+                for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                    vals[j] *= inv_shape_par_d;
+                }
+
+                batch_exp(vals,n_vals);
+            }
+
+            for (ullint_t j=ullint_t(0); j < n_vals; ++j) {
+                vals[j] *= scale_par_d;
+            }
+        });
+}
+
 template<typename T1, typename T2, typename rT>
 statslib_inline
 void
-rweibull_vec(const T1 shape_par, const T2 scale_par, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+rweibull_vec(const T1 shape_par, const T2 scale_par, const ullint_t seed_val, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
 {
-    RAND_DIST_FN_VEC(rweibull,vals_out,num_elem,shape_par,scale_par);
+    RAND_DIST_FN_VEC_FILL(rweibull_fill,vals_out,num_elem,seed_val,shape_par,scale_par);
+}
+
+template<typename T1, typename T2, typename rngT, typename rT>
+statslib_inline
+void
+rweibull_vec(const T1 shape_par, const T2 scale_par, rngT& engine, rT* __stats_pointer_settings__ vals_out, const ullint_t num_elem)
+{
+    rweibull_fill(shape_par,scale_par,engine,vals_out,num_elem);
 }
 #endif
 
@@ -118,9 +211,17 @@ rweibull_vec(const T1 shape_par, const T2 scale_par, rT* __stats_pointer_setting
 template<typename eT, typename T1, typename T2>
 statslib_inline
 void
-rweibull_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 scale_par)
+rweibull_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 scale_par, const ullint_t seed_val)
+{
+    STDVEC_RAND_DIST_FN(rweibull,shape_par,scale_par,seed_val);
+}
+
+template<typename eT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rweibull_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 scale_par, rngT& engine)
 {
-    STDVEC_RAND_DIST_FN(rweibull,shape_par,scale_par);
+    STDVEC_RAND_DIST_FN(rweibull,shape_par,scale_par,engine);
 }
 #endif
 
@@ -128,9 +229,17 @@ rweibull_mat_check(std::vector<eT>& X, const T1 shape_par, const T2 scale_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 void
-rweibull_mat_check(mT& X, const T1 shape_par, const T2 scale_par)
+rweibull_mat_check(mT& X, const T1 shape_par, const T2 scale_par, const ullint_t seed_val)
+{
+    MAIN_MAT_RAND_DIST_FN(rweibull,shape_par,scale_par,seed_val);
+}
+
+template<typename mT, typename T1, typename T2, typename rngT>
+statslib_inline
+void
+rweibull_mat_check(mT& X, const T1 shape_par, const T2 scale_par, rngT& engine)
 {
-    MAIN_MAT_RAND_DIST_FN(rweibull,shape_par,scale_par);
+    MAIN_MAT_RAND_DIST_FN(rweibull,shape_par,scale_par,engine);
 }
 #endif
 
@@ -143,6 +252,7 @@ rweibull_mat_check(mT& X, const T1 shape_par, const T2 scale_par)
  * @param k the number of output columns
  * @param shape_par the shape parameter, a real-valued input.
  * @param scale_par the scale parameter, a real-valued input.
+ * @param seed_val initialize the random engine with a non-negative integral-valued seed.
  *
  * @return a matrix of pseudo-random draws from the Weibull distribution.
  *
@@ -158,6 +268,8 @@ rweibull_mat_check(mT& X, const T1 shape_par, const T2 scale_par)
  * stats::rweibull<Eigen::MatrixXd>(5,4,3.0,2.0);
  * \endcode
  *
+ * @note For a given \c seed_val, the output is identical regardless of the number of OpenMP threads used.
+ *
  * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
  */
 
@@ -165,8 +277,47 @@ rweibull_mat_check(mT& X, const T1 shape_par, const T2 scale_par)
 template<typename mT, typename T1, typename T2>
 statslib_inline
 mT
-rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par)
+rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, const ullint_t seed_val)
+{
+    GEN_MAT_RAND_FN(rweibull_mat_check,shape_par,scale_par,seed_val);
+}
+#endif
+
+/**
+ * @brief Random matrix sampling function for the Weibull distribution
+ *
+ * @param n the number of output rows
+ * @param k the number of output columns
+ * @param shape_par the shape parameter, a real-valued input.
+ * @param scale_par the scale parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
+ *
+ * @return a matrix of pseudo-random draws from the Weibull distribution.
+ *
+ * Example:
+ * \code{.cpp}
+ * stats::rand_engine_t engine(1776);
+ * // std::vector
+ * stats::rweibull<std::vector<double>>(5,4,3.0,2.0,engine);
+ * // Armadillo matrix
+ * stats::rweibull<arma::mat>(5,4,3.0,2.0,engine);
+ * // Blaze dynamic matrix
+ * stats::rweibull<blaze::DynamicMatrix<double,blaze::columnMajor>>(5,4,3.0,2.0,engine);
+ * // Eigen dynamic matrix
+ * stats::rweibull<Eigen::MatrixXd>(5,4,3.0,2.0,engine);
+ * \endcode
+ *
+ * @note Draws are generated sequentially from \c engine, which is advanced by the number of draws required.
+ *
+ * @note This function requires template instantiation; acceptable output types include: <tt>std::vector</tt>, with element type \c float, \c double, etc., as well as Armadillo, Blaze, and Eigen dense matrices.
+ */
+
+#ifdef STATS_ENABLE_INTERNAL_VEC_FEATURES
+template<typename mT, typename T1, typename T2, typename rngT, typename enable_if_engine<rngT>::type*>
+statslib_inline
+mT
+rweibull(const ullint_t n, const ullint_t k, const T1 shape_par, const T2 scale_par, rngT& engine)
 {
-    GEN_MAT_RAND_FN(rweibull_mat_check,shape_par,scale_par);
+    GEN_MAT_RAND_FN(rweibull_mat_check,shape_par,scale_par,engine);
 }
 #endif
@@ -31,11 +31,19 @@ template<typename mT, typename pT, typename not_arma_mat<mT>::type* = nullptr>
 statslib_inline
 mT rwish(const mT& Psi_par, const pT nu_par, const bool pre_chol = false);
 
+template<typename mT, typename pT, typename rngT, typename not_arma_mat<mT>::type* = nullptr, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT rwish(const mT& Psi_par, const pT nu_par, rngT& engine, const bool pre_chol = false);
+
 // specializations
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
 template<typename mT, typename eT, typename pT>
 statslib_inline
 mT rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_chol = false);
+
+template<typename mT, typename eT, typename pT, typename rngT, typename enable_if_engine<rngT>::type* = nullptr>
+statslib_inline
+mT rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, rngT& engine, const bool pre_chol = false);
 #endif
 
 #include "rwish.ipp"
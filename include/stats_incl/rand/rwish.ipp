@@ -27,15 +27,16 @@
  *
  * @param Psi_par a positive semi-definite scale matrix.
  * @param nu_par the degrees of parameter, a real-valued input.
+ * @param engine a random engine, passed by reference.
  * @param pre_chol indicate whether \c Psi_par is passed in lower triangular (Cholesky) format.
  *
  * @return a pseudo-random draw from the Wishart distribution.
  */
 
-template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
+template<typename mT, typename pT, typename rngT, typename not_arma_mat<mT>::type*, typename enable_if_engine<rngT>::type*>
 statslib_inline
 mT
-rwish(const mT& Psi_par, const pT nu_par, const bool pre_chol)
+rwish(const mT& Psi_par, const pT nu_par, rngT& engine, const bool pre_chol)
 {
     typedef return_t<pT> eT;
     const ullint_t K = mat_ops::n_rows(Psi_par);
@@ -49,8 +50,6 @@ rwish(const mT& Psi_par, const pT nu_par, const bool pre_chol)
 
     //
 
-    rand_engine_t engine(std::random_device{}());
-
     mT A;
     mat_ops::zeros(A,K,K);
 
@@ -71,11 +70,29 @@ rwish(const mT& Psi_par, const pT nu_par, const bool pre_chol)
     return chol_Psi * mat_ops::trans(chol_Psi);
 }
 
+/**
+ * @brief Random sampling function for the Wishart distribution
+ *
+ * @param Psi_par a positive semi-definite scale matrix.
+ * @param nu_par the degrees of parameter, a real-valued input.
+ * @param pre_chol indicate whether \c Psi_par is passed in lower triangular (Cholesky) format.
+ *
+ * @return a pseudo-random draw from the Wishart distribution.
+ */
+
+template<typename mT, typename pT, typename not_arma_mat<mT>::type*>
+statslib_inline
+mT
+rwish(const mT& Psi_par, const pT nu_par, const bool pre_chol)
+{
+    return rwish(Psi_par,nu_par,internal::default_engine(),pre_chol);
+}
+
 #ifdef STATS_ENABLE_ARMA_WRAPPERS
-template<typename mT, typename eT, typename pT>
+template<typename mT, typename eT, typename pT, typename rngT, typename enable_if_engine<rngT>::type*>
 statslib_inline
 mT
-rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_chol)
+rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, rngT& engine, const bool pre_chol)
 {
     const ullint_t K = Psi_par.n_rows;
     
@@ -83,8 +100,6 @@ rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_chol)
 
     //
 
-    rand_engine_t engine(std::random_device{}());
-
     ArmaMat<eT> A = arma::zeros(K,K);
 
     for (ullint_t i=1U; i < K; i++) {
@@ -103,4 +118,12 @@ rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_chol)
     
     return chol_Psi * chol_Psi.t();
 }
+
+template<typename mT, typename eT, typename pT>
+statslib_inline
+mT
+rwish(const ArmaMat<eT>& Psi_par, const pT nu_par, const bool pre_chol)
+{
+    return rwish<mT>(Psi_par,nu_par,internal::default_engine(),pre_chol);
+}
 #endif
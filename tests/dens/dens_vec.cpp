@@ -0,0 +1,72 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+// compare the batched (vector) evaluation of each density with the scalar function
+
+int main()
+{
+    print_begin("dens_vec");
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+
+    // a grid over [-20,20], not a multiple of the batch size, with special values mixed in
+
+    std::vector<double> inp_vals;
+
+    for (int i = 0; i < 1001; ++i) {
+        inp_vals.push_back(-20.0 + 0.04*i);
+    }
+
+    inp_vals[3] = TEST_NAN;
+    inp_vals[257] = TEST_POSINF;
+    inp_vals[600] = TEST_NEGINF;
+    inp_vals[999] = 1e-310; // subnormal
+    inp_vals.push_back(1e200);
+    inp_vals.push_back(-1e200);
+
+    //
+
+    STATS_TEST_VEC_VS_SCALAR(dnorm,inp_vals,1.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(dnorm,inp_vals,1.0,0.0);        // degenerate; left to the scalar function
+    STATS_TEST_VEC_VS_SCALAR(dlnorm,inp_vals,1.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(dexp,inp_vals,0.5);
+    STATS_TEST_VEC_VS_SCALAR(dexp,inp_vals,TEST_POSINF);
+    STATS_TEST_VEC_VS_SCALAR(dlogis,inp_vals,1.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(dlogis,inp_vals,1.0,0.01);
+    STATS_TEST_VEC_VS_SCALAR(dcauchy,inp_vals,1.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(dcauchy,inp_vals,TEST_NAN,2.0);
+    STATS_TEST_VEC_VS_SCALAR(dlaplace,inp_vals,1.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(dgamma,inp_vals,2.0,3.0);
+    STATS_TEST_VEC_VS_SCALAR(dgamma,inp_vals,0.5,1.5);
+    STATS_TEST_VEC_VS_SCALAR(dgamma,inp_vals,0.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(dt,inp_vals,11.0);
+    STATS_TEST_VEC_VS_SCALAR(dt,inp_vals,0.5);
+    STATS_TEST_VEC_VS_SCALAR(dt,inp_vals,TEST_POSINF);
+
+#endif
+
+    //
+
+    print_final("dens_vec");
+
+    return 0;
+}
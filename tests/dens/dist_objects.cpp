@@ -0,0 +1,133 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+// compare distribution object methods with the corresponding free functions
+
+static const std::vector<double> x_grid = { TEST_NAN, TEST_NEGINF, -50.0, -3.5, -1.0, -1e-03, 0.0, 1e-03, 0.25, 0.5, 
+                                            0.99, 1.0, 1.5, 2.0, 7.5, 40.0, TEST_POSINF };
+static const std::vector<double> p_grid = { TEST_NAN, -0.1, 0.0, 1e-10, 0.025, 0.3, 0.5, 0.75, 0.999, 1.0, 1.1 };
+
+#define STATS_TEST_DIST_OBJ(dist_obj, stem, ...)                                                    \
+{                                                                                                   \
+    for (double x : x_grid) {                                                                       \
+        check_close(#stem "_dist::pdf",x,dist_obj.pdf(x),stats::d##stem(x,__VA_ARGS__,false));     \
+        check_close(#stem "_dist::logpdf",x,dist_obj.logpdf(x),stats::d##stem(x,__VA_ARGS__,true));\
+        check_close(#stem "_dist::cdf",x,dist_obj.cdf(x),stats::p##stem(x,__VA_ARGS__,false));     \
+    }                                                                                               \
+    for (double p : p_grid) {                                                                       \
+        check_close(#stem "_dist::quantile",p,dist_obj.quantile(p),stats::q##stem(p,__VA_ARGS__)); \
+    }                                                                                               \
+}
+
+#define STATS_TEST_DISCRETE_DIST_OBJ(dist_obj, stem, x_max, ...)                                    \
+{                                                                                                   \
+    for (stats::llint_t x = -1; x <= x_max; ++x) {                                                 \
+        check_close(#stem "_dist::pdf",x,dist_obj.pdf(x),stats::d##stem(x,__VA_ARGS__,false));     \
+        check_close(#stem "_dist::logpdf",x,dist_obj.logpdf(x),stats::d##stem(x,__VA_ARGS__,true));\
+        check_close(#stem "_dist::cdf",x,dist_obj.cdf(x),stats::p##stem(x,__VA_ARGS__,false));     \
+    }                                                                                               \
+    for (double p : p_grid) {                                                                       \
+        check_close(#stem "_dist::quantile",p,dist_obj.quantile(p),stats::q##stem(p,__VA_ARGS__)); \
+    }                                                                                               \
+}
+
+int main()
+{
+    print_begin("dist_objects");
+
+    //
+    // continuous distributions, including parameters on the boundary (handled by the free functions)
+
+    STATS_TEST_DIST_OBJ(stats::beta_dist(3.0,2.0),beta,3.0,2.0);
+    STATS_TEST_DIST_OBJ(stats::beta_dist(0.5,0.5),beta,0.5,0.5);
+    STATS_TEST_DIST_OBJ(stats::cauchy_dist(1.0,2.0),cauchy,1.0,2.0);
+    STATS_TEST_DIST_OBJ(stats::cauchy_dist(1.0,0.0),cauchy,1.0,0.0);
+    STATS_TEST_DIST_OBJ(stats::chisq_dist(4.0),chisq,4.0);
+    STATS_TEST_DIST_OBJ(stats::chisq_dist(1.0),chisq,1.0);
+    STATS_TEST_DIST_OBJ(stats::exp_dist(4.0),exp,4.0);
+    STATS_TEST_DIST_OBJ(stats::exp_dist(TEST_POSINF),exp,TEST_POSINF);
+    STATS_TEST_DIST_OBJ(stats::f_dist(3.0,2.0),f,3.0,2.0);
+    STATS_TEST_DIST_OBJ(stats::f_dist(10.0,25.0),f,10.0,25.0);
+    STATS_TEST_DIST_OBJ(stats::gamma_dist(2.0,3.0),gamma,2.0,3.0);
+    STATS_TEST_DIST_OBJ(stats::gamma_dist(0.5,1.5),gamma,0.5,1.5);
+    STATS_TEST_DIST_OBJ(stats::invgamma_dist(2.0,3.0),invgamma,2.0,3.0);
+    STATS_TEST_DIST_OBJ(stats::laplace_dist(1.0,2.0),laplace,1.0,2.0);
+    STATS_TEST_DIST_OBJ(stats::laplace_dist(1.0,0.0),laplace,1.0,0.0);
+    STATS_TEST_DIST_OBJ(stats::lnorm_dist(1.0,2.0),lnorm,1.0,2.0);
+    STATS_TEST_DIST_OBJ(stats::logis_dist(1.0,2.0),logis,1.0,2.0);
+    STATS_TEST_DIST_OBJ(stats::norm_dist(1.0,2.0),norm,1.0,2.0);
+    STATS_TEST_DIST_OBJ(stats::norm_dist(1.0,0.0),norm,1.0,0.0);
+    STATS_TEST_DIST_OBJ(stats::norm_dist(TEST_NAN,1.0),norm,TEST_NAN,1.0);
+    STATS_TEST_DIST_OBJ(stats::t_dist(11.0),t,11.0);
+    STATS_TEST_DIST_OBJ(stats::t_dist(TEST_POSINF),t,TEST_POSINF);
+    STATS_TEST_DIST_OBJ(stats::unif_dist(-1.0,2.0),unif,-1.0,2.0);
+    STATS_TEST_DIST_OBJ(stats::unif_dist(2.0,-1.0),unif,2.0,-1.0);
+    STATS_TEST_DIST_OBJ(stats::weibull_dist(2.0,3.0),weibull,2.0,3.0);
+    STATS_TEST_DIST_OBJ(stats::weibull_dist(0.5,1.0),weibull,0.5,1.0);
+
+    //
+    // discrete distributions
+
+    STATS_TEST_DISCRETE_DIST_OBJ(stats::bern_dist(0.7),bern,2,0.7);
+    STATS_TEST_DISCRETE_DIST_OBJ(stats::bern_dist(1.0),bern,2,1.0);
+    STATS_TEST_DISCRETE_DIST_OBJ(stats::binom_dist(10,0.6),binom,12,10,0.6);
+    STATS_TEST_DISCRETE_DIST_OBJ(stats::binom_dist(1,0.6),binom,2,1,0.6);
+    STATS_TEST_DISCRETE_DIST_OBJ(stats::binom_dist(10,0.0),binom,12,10,0.0);
+    STATS_TEST_DISCRETE_DIST_OBJ(stats::pois_dist(8.0),pois,30,8.0);
+    STATS_TEST_DISCRETE_DIST_OBJ(stats::pois_dist(0.0),pois,3,0.0);
+
+    //
+    // lower tail of the Cauchy CDF, against 1/(pi |z|) with a relative error check
+
+    stats::cauchy_dist cauchy_obj(0.0,1.0);
+
+    check_close("cauchy_dist::cdf",-1e8,cauchy_obj.cdf(-1e8),3.183098861837907e-09,true);
+    check_close("cauchy_dist::cdf",-1e300,cauchy_obj.cdf(-1e300),3.183098861837907e-301,true);
+    check_close("cauchy_dist::cdf",-50.0,cauchy_obj.cdf(-50.0),stats::pcauchy(-50.0,0.0,1.0),true);
+
+    //
+    // array input
+
+    stats::gamma_dist gamma_obj(2.0,3.0);
+
+    std::vector<double> inp_vals = { 1.0,         2.0,        3.0 };
+    std::vector<double> exp_vals = { 0.07961459,  0.1140927,  0.1226265 };
+    std::vector<double> out_vals(inp_vals.size());
+
+    gamma_obj.pdf(inp_vals.data(),out_vals.data(),inp_vals.size());
+
+    for (size_t j = 0; j < inp_vals.size(); ++j) {
+        check_close("gamma_dist::pdf",inp_vals[j],out_vals[j],exp_vals[j]);
+    }
+
+    gamma_obj.logpdf(inp_vals.data(),out_vals.data(),inp_vals.size());
+
+    for (size_t j = 0; j < inp_vals.size(); ++j) {
+        check_close("gamma_dist::logpdf",inp_vals[j],out_vals[j],std::log(exp_vals[j]));
+    }
+
+    //
+
+    print_final("dist_objects");
+
+    return 0;
+}
@@ -44,6 +44,11 @@ int main()
     STATS_TEST_EXPECTED_VAL(dnorm,inp_vals[1],exp_vals[1],true,mu,sigma);
     STATS_TEST_EXPECTED_VAL(dnorm,inp_vals[2],exp_vals[2],false,mu,sigma);
 
+#ifndef STATS_GO_INLINE
+    constexpr double dens_cexpr = stats::dnorm(2.0,1.0,2.0,false);                                  // compile-time vs run-time
+    STATS_TEST_EXPECTED_VAL(dnorm,inp_vals[0],dens_cexpr,false,mu,sigma);
+#endif
+
     STATS_TEST_EXPECTED_VAL(dnorm,TEST_NAN,TEST_NAN,false,0,1);                                     // Input NaNs
     STATS_TEST_EXPECTED_VAL(dnorm,0,TEST_NAN,false,TEST_NAN,1);
     STATS_TEST_EXPECTED_VAL(dnorm,0,TEST_NAN,false,0,TEST_NAN);
@@ -48,6 +48,11 @@ int main()
     STATS_TEST_EXPECTED_VAL(pbeta,0.01,3.97e-06,false,3,2);
     STATS_TEST_EXPECTED_VAL(pbeta,0.99,0.999408,false,3,2);
 
+    STATS_TEST_EXPECTED_VAL(pbeta,0.6,0.860190660480153,false,200,150);                             // large shape parameters
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    STATS_TEST_EXPECTED_VAL(pbeta,0.05,6.84541614214406e-27,true,30,20);                            // lower tail, runtime kernel
+#endif
+
     STATS_TEST_EXPECTED_VAL(pbeta,TEST_NAN,TEST_NAN,false,2,3);                                     // NaN inputs
     STATS_TEST_EXPECTED_VAL(pbeta,0.5,TEST_NAN,false,TEST_NAN,3);
     STATS_TEST_EXPECTED_VAL(pbeta,0.5,TEST_NAN,false,1.0,TEST_NAN);
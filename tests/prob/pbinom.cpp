@@ -45,6 +45,11 @@ int main()
     STATS_TEST_EXPECTED_VAL(pbinom,inp_vals[2],exp_vals[2],false,n_trials,prob_par);
     STATS_TEST_EXPECTED_VAL(pbinom,inp_vals[1],exp_vals[1],true,n_trials,prob_par);
 
+    STATS_TEST_EXPECTED_VAL(pbinom,300,0.51559351981412,false,1000,0.3);                            // large n_trials
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    STATS_TEST_EXPECTED_VAL(pbinom,10,2.48333879148964e-278,true,1000,0.5);                         // lower tail, runtime kernel
+#endif
+
     STATS_TEST_EXPECTED_VAL(pbinom,1,TEST_NAN,false,2,TEST_NAN);                                    // NaN inputs
 
     STATS_TEST_EXPECTED_VAL(pbinom,-1,0,false,n_trials,prob_par);                                   // x < 0 or x >= n_trials 
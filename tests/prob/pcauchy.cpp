@@ -45,6 +45,8 @@ int main()
     STATS_TEST_EXPECTED_VAL(pcauchy,inp_vals[2],exp_vals[2],false,mu,sigma);
 
     STATS_TEST_EXPECTED_VAL(pcauchy,1001,0.999682,false,0,1);
+    STATS_TEST_EXPECTED_VAL(pcauchy,-1001,0.0003179918,false,0,1);
+    STATS_TEST_EXPECTED_VAL(pcauchy,-1e20,3.183098861837907e-21,true,0,1);                         // lower tail, log scale
 
     STATS_TEST_EXPECTED_VAL(pcauchy,TEST_NAN,TEST_NAN,false,0,1);                                   // Input NaNs
     STATS_TEST_EXPECTED_VAL(pcauchy,0,TEST_NAN,false,TEST_NAN,1);
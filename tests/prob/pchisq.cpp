@@ -43,6 +43,11 @@ int main()
     STATS_TEST_EXPECTED_VAL(pchisq,inp_vals[1],exp_vals[1],true,dof);
     STATS_TEST_EXPECTED_VAL(pchisq,inp_vals[2],exp_vals[2],false,dof);
 
+    STATS_TEST_EXPECTED_VAL(pchisq,250,0.990620868331174,false,200);                                // large dof
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    STATS_TEST_EXPECTED_VAL(pchisq,1e-20,7.97884560802865e-11,true,1);                              // x below epsilon, runtime kernel
+#endif
+
     STATS_TEST_EXPECTED_VAL(pchisq,TEST_NAN,TEST_NAN,false,3);                                      // Input NaNs
     STATS_TEST_EXPECTED_VAL(pchisq,1,TEST_NAN,false,TEST_NAN);
     STATS_TEST_EXPECTED_VAL(pchisq,TEST_NAN,TEST_NAN,false,TEST_NAN);
@@ -45,6 +45,11 @@ int main()
     STATS_TEST_EXPECTED_VAL(pf,inp_vals[2],exp_vals[2],false,a_par,b_par);
     STATS_TEST_EXPECTED_VAL(pf,inp_vals[1],exp_vals[1],true,a_par,b_par);
 
+    STATS_TEST_EXPECTED_VAL(pf,2,0.970633764279794,false,10,1e4);                                   // large dof
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    STATS_TEST_EXPECTED_VAL(pf,1e-4,1.02223257581025e-34,true,20,10);                               // lower tail, runtime kernel
+#endif
+
     STATS_TEST_EXPECTED_VAL(pf,TEST_NAN,TEST_NAN,false,a_par,b_par);                                // NaN inputs
     STATS_TEST_EXPECTED_VAL(pf,2,TEST_NAN,false,TEST_NAN,b_par);
     STATS_TEST_EXPECTED_VAL(pf,2,TEST_NAN,false,a_par,TEST_NAN);
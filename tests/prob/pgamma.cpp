@@ -45,6 +45,16 @@ int main()
     STATS_TEST_EXPECTED_VAL(pgamma,inp_vals[2],exp_vals[2],false,shape_par,scale_par);
     STATS_TEST_EXPECTED_VAL(pgamma,inp_vals[1],exp_vals[1],true,shape_par,scale_par);
 
+    STATS_TEST_EXPECTED_VAL(pgamma,110,0.841721329939913,false,100,1);                              // large shape, x near the mode
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    STATS_TEST_EXPECTED_VAL(pgamma,2,3.13088665628071e-48,true,60,0.5);                             // lower tail, runtime kernel
+
+    // large shape, far tails, against quad-precision values with a relative error check
+
+    check_close("pgamma",914.65,stats::pgamma(914.65,1862.93,1.0),3.58767177120507466e-166,true,5e-13);
+    check_close("pgamma",3358.4,stats::pgamma(3358.4,1962.8,1.0,true),-6.85567770042205440e-151,true,5e-13);
+#endif
+
     STATS_TEST_EXPECTED_VAL(pgamma,TEST_NAN,TEST_NAN,false,shape_par,scale_par);                    // NaN inputs
     STATS_TEST_EXPECTED_VAL(pgamma,2,TEST_NAN,false,TEST_NAN,scale_par);
     STATS_TEST_EXPECTED_VAL(pgamma,2,TEST_NAN,false,shape_par,TEST_NAN);
@@ -45,6 +45,10 @@ int main()
     STATS_TEST_EXPECTED_VAL(pinvgamma,inp_vals[2],exp_vals[2],false,shape_par,rate_par);
     STATS_TEST_EXPECTED_VAL(pinvgamma,inp_vals[1],exp_vals[1],true,shape_par,rate_par);
 
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    STATS_TEST_EXPECTED_VAL(pinvgamma,0.01,1.61393053369773e-37,true,5,1);                          // lower tail, runtime kernel
+#endif
+
     STATS_TEST_EXPECTED_VAL(pinvgamma,0.3,0.03803761,false,shape_par,rate_par);
     STATS_TEST_EXPECTED_VAL(pinvgamma,3.5,0.9796131,false,shape_par,rate_par);
     STATS_TEST_EXPECTED_VAL(pinvgamma,7.5,0.9974089,false,shape_par,rate_par);
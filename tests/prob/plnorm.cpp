@@ -44,6 +44,8 @@ int main()
     STATS_TEST_EXPECTED_VAL(plnorm,inp_vals[1],exp_vals[1],true,mu,sigma);
     STATS_TEST_EXPECTED_VAL(plnorm,inp_vals[2],exp_vals[2],false,mu,sigma);
 
+    STATS_TEST_EXPECTED_VAL(plnorm,1e-30,3.9992923444065e-67,true,0,4);                             // lower tail, x below epsilon
+
     STATS_TEST_EXPECTED_VAL(plnorm,TEST_NAN,TEST_NAN,false,0,1);                                    // Input NaNs
     STATS_TEST_EXPECTED_VAL(plnorm,0,TEST_NAN,false,TEST_NAN,1);
     STATS_TEST_EXPECTED_VAL(plnorm,0,TEST_NAN,false,0,TEST_NAN);
@@ -44,6 +44,13 @@ int main()
     STATS_TEST_EXPECTED_VAL(pnorm,inp_vals[1],exp_vals[1],true,mu,sigma);
     STATS_TEST_EXPECTED_VAL(pnorm,inp_vals[2],exp_vals[2],false,mu,sigma);
 
+    STATS_TEST_EXPECTED_VAL(pnorm,-39.0,2.7536241186062e-89,true,mu,sigma);                      // lower tail (z = -20)
+
+#ifndef STATS_GO_INLINE
+    constexpr double prob_cexpr = stats::pnorm(-39.0,1.0,2.0,true);                              // compile-time vs run-time
+    STATS_TEST_EXPECTED_VAL(pnorm,-39.0,std::exp(prob_cexpr),true,mu,sigma);
+#endif
+
     STATS_TEST_EXPECTED_VAL(pnorm,TEST_NAN,TEST_NAN,false,0,1);                                  // Input NaNs
     STATS_TEST_EXPECTED_VAL(pnorm,0,TEST_NAN,false,TEST_NAN,1);
     STATS_TEST_EXPECTED_VAL(pnorm,0,TEST_NAN,false,0,TEST_NAN);
@@ -43,6 +43,11 @@ int main()
     STATS_TEST_EXPECTED_VAL(ppois,inp_vals[1],exp_vals[1],true,rate);
     STATS_TEST_EXPECTED_VAL(ppois,inp_vals[2],exp_vals[2],false,rate);
 
+    STATS_TEST_EXPECTED_VAL(ppois,180,0.0822289048366097,false,200);                                // large rate
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    STATS_TEST_EXPECTED_VAL(ppois,5,3.78452365787647e-78,true,200);                                 // lower tail, runtime kernel
+#endif
+
     STATS_TEST_EXPECTED_VAL(ppois,1,TEST_NAN,false,TEST_NAN);                                       // Input NaNs
 
     STATS_TEST_EXPECTED_VAL(ppois,0,1,false,0);                                                     // rate <= 0
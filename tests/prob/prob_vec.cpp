@@ -0,0 +1,81 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+// compare the batched (vector) evaluation of each distribution function with the scalar function
+
+int main()
+{
+    print_begin("prob_vec");
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+
+    // a grid over [-40,40], not a multiple of the batch size, with special values mixed in
+
+    std::vector<double> inp_vals;
+
+    for (int i = 0; i < 2001; ++i) {
+        inp_vals.push_back(-40.0 + 0.04*i);
+    }
+
+    inp_vals[3] = TEST_NAN;
+    inp_vals[257] = TEST_POSINF;
+    inp_vals[600] = TEST_NEGINF;
+    inp_vals[1999] = 1e-310; // subnormal
+    inp_vals.push_back(1e-30);
+    inp_vals.push_back(1e200);
+    inp_vals.push_back(-1e200);
+
+    //
+
+    STATS_TEST_VEC_VS_SCALAR(pnorm,inp_vals,1.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(pnorm,inp_vals,-3.0,0.5);
+    STATS_TEST_VEC_VS_SCALAR(pnorm,inp_vals,1.0,0.0);   // degenerate; left to the scalar function
+    STATS_TEST_VEC_VS_SCALAR(plnorm,inp_vals,1.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(plnorm,inp_vals,0.0,0.1);
+
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    // with gcem in the scalar functions, results differ in the far tails
+
+    STATS_TEST_VEC_VS_SCALAR(pgamma,inp_vals,2.0,3.0);
+    STATS_TEST_VEC_VS_SCALAR(pgamma,inp_vals,0.3,1.0);
+    STATS_TEST_VEC_VS_SCALAR(pgamma,inp_vals,150.0,0.2); // includes the Temme regime
+    STATS_TEST_VEC_VS_SCALAR(pchisq,inp_vals,3.0);
+    STATS_TEST_VEC_VS_SCALAR(pchisq,inp_vals,0.0);      // degenerate; left to the scalar function
+    STATS_TEST_VEC_VS_SCALAR(pinvgamma,inp_vals,2.0,3.0);
+    STATS_TEST_VEC_VS_SCALAR(pinvgamma,inp_vals,40.0,100.0);
+    STATS_TEST_VEC_VS_SCALAR(pbeta,inp_vals,3.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(pbeta,inp_vals,0.5,200.0);
+    STATS_TEST_VEC_VS_SCALAR(pf,inp_vals,10.0,12.0);
+    STATS_TEST_VEC_VS_SCALAR(pf,inp_vals,3.0,1e4);
+    STATS_TEST_VEC_VS_SCALAR(pt,inp_vals,11.0);
+    STATS_TEST_VEC_VS_SCALAR(pt,inp_vals,1e6);
+    STATS_TEST_VEC_VS_SCALAR(pt,inp_vals,2.0);          // closed form; left to the scalar function
+#endif
+
+#endif
+
+    //
+
+    print_final("prob_vec");
+
+    return 0;
+}
@@ -61,6 +61,11 @@ int main()
     STATS_TEST_EXPECTED_VAL(pt,1.0,0.8282818,false,9.0);                                            // dof == 9
     STATS_TEST_EXPECTED_VAL(pt,1.0,0.8295534,false,10.0);                                           // dof == 10
 
+    STATS_TEST_EXPECTED_VAL(pt,-3.0,0.0013499312707109,false,1e6);                                  // large dof
+#if defined(STATS_GO_INLINE) || defined(STATS_USE_RUNTIME_MATH)
+    STATS_TEST_EXPECTED_VAL(pt,-40.0,9.20598108588648e-08,true,5.0);                                // lower tail, runtime kernel
+#endif
+
     STATS_TEST_EXPECTED_VAL(pt,0,0.5,false,TEST_POSINF);                                            // dt(x,+Inf) => dnorm(x,0,1)
     STATS_TEST_EXPECTED_VAL(pt,TEST_POSINF,1,false,TEST_POSINF);
 
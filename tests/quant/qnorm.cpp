@@ -47,6 +47,12 @@ int main()
     STATS_TEST_EXPECTED_QUANT_VAL(qnorm,inp_vals[2],exp_vals[2],mu,sigma);
 
     STATS_TEST_EXPECTED_QUANT_VAL(qnorm,0.9995,3.290527,0,1);
+    STATS_TEST_EXPECTED_QUANT_VAL(qnorm,1e-300,-37.0470962993612,0,1);                              // lower tail
+
+#ifndef STATS_GO_INLINE
+    constexpr double quant_cexpr = stats::qnorm(0.01,1.0,2.0);                                      // compile-time vs run-time
+    STATS_TEST_EXPECTED_QUANT_VAL(qnorm,0.01,quant_cexpr,mu,sigma);
+#endif
 
     STATS_TEST_EXPECTED_QUANT_VAL(qnorm,TEST_NAN,TEST_NAN,0,1);                                     // Input NaNs
     STATS_TEST_EXPECTED_QUANT_VAL(qnorm,0,TEST_NAN,TEST_NAN,1);
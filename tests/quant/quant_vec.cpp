@@ -0,0 +1,63 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#define STATS_TEST_INPUT_TYPE 1
+
+#include "../stats_tests.hpp"
+
+// compare the batched (vector) evaluation of each quantile function with the scalar function
+
+int main()
+{
+    print_begin("quant_vec");
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+
+    // a grid over (0,1), not a multiple of the batch size, with tail and special values mixed in
+
+    std::vector<double> inp_vals;
+
+    for (int i = 1; i < 1000; ++i) {
+        inp_vals.push_back(0.001*i);
+    }
+
+    inp_vals[3] = TEST_NAN;
+    inp_vals[257] = 0.0;
+    inp_vals[600] = 1.0;
+    inp_vals[601] = -0.5;
+    inp_vals[998] = 1e-310; // subnormal
+    inp_vals.push_back(1e-300);
+    inp_vals.push_back(1e-20);
+    inp_vals.push_back(1.0 - 1e-16);
+
+    //
+
+    STATS_TEST_VEC_VS_SCALAR(qnorm,inp_vals,1.0,2.0);
+    STATS_TEST_VEC_VS_SCALAR(qnorm,inp_vals,-3.0,0.5);
+    STATS_TEST_VEC_VS_SCALAR(qnorm,inp_vals,1.0,0.0);   // degenerate; left to the scalar function
+
+#endif
+
+    //
+
+    print_final("quant_vec");
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+// the batch math kernels behind the bulk samplers, against <cmath> in long double;
+// errors are measured in units in the last place (ulp) of the double result
+
+#include "../stats_tests.hpp"
+
+inline
+double
+ulp_error(const double val, const long double ref)
+{
+    const double ref_d = static_cast<double>(ref);
+    const double ulp = std::nextafter(std::abs(ref_d), TEST_POSINF) - std::abs(ref_d);
+
+    return static_cast<double>(std::abs(static_cast<long double>(val) - ref) / ulp);
+}
+
+// run a kernel over inp_vals (padded to a multiple of the kernel width) and check each value against ref_fn
+
+template<typename kernelT, typename refT>
+double
+check_kernel(const std::string fn_name, const kernelT& kernel_fn, const refT& ref_fn,
+             const std::vector<double>& inp_vals, const double max_ulp)
+{
+    using stats::ullint_t;
+
+    const ullint_t n_padded = STATS_BATCH_MATH_WIDTH * ((inp_vals.size() + STATS_BATCH_MATH_WIDTH - 1) / STATS_BATCH_MATH_WIDTH);
+
+    std::vector<double> vals(n_padded, 0.5);
+    std::copy(inp_vals.begin(), inp_vals.end(), vals.begin());
+
+    kernel_fn(vals.data(), n_padded);
+
+    double worst_ulp = 0.0;
+
+    for (size_t j = 0; j < inp_vals.size(); ++j) {
+        const long double ref = ref_fn(static_cast<long double>(inp_vals[j]));
+        const double ref_d = static_cast<double>(ref);
+
+        if (std::isnan(ref) || std::isinf(ref_d)) {
+            // special values and overflow must match exactly
+            check_close(fn_name,inp_vals[j],vals[j],ref_d);
+            continue;
+        }
+
+        worst_ulp = std::max(worst_ulp, ulp_error(vals[j],ref));
+
+        // max_ulp from the exact value, plus half an ulp for the rounding of the reference to double
+
+        const double ulp = std::nextafter(std::abs(ref_d), TEST_POSINF) - std::abs(ref_d);
+
+        if (std::abs(ref_d) < std::numeric_limits<double>::min()) {
+            check_close(fn_name,inp_vals[j],vals[j],ref_d,false,(max_ulp + 0.5)*ulp);
+        } else {
+            check_close(fn_name,inp_vals[j],vals[j],ref_d,true,(max_ulp + 0.5)*ulp / std::abs(ref_d));
+        }
+    }
+
+    std::cout << fn_name << ": largest error " << worst_ulp << " ulp. Should be at most: " << max_ulp << std::endl;
+
+    return worst_ulp;
+}
+
+int main()
+{
+    print_begin("batch_math");
+
+    std::mt19937_64 engine(1776);
+    std::uniform_real_distribution<double> unif_dist(0.0, 1.0);
+
+    const long double pi_l = 3.141592653589793238462643383279502884L;
+
+    //
+    // log: all binades, including subnormals, the sqrt(2) split point, and special values
+
+    std::vector<double> log_inp = { 1.0, std::nextafter(1.0,0.0), std::nextafter(1.0,2.0), 0.5, 2.0,
+                                    std::sqrt(2.0), std::nextafter(std::sqrt(2.0),0.0), std::sqrt(0.5),
+                                    std::numeric_limits<double>::min(), std::numeric_limits<double>::max(), std::numeric_limits<double>::denorm_min(), 1e-320,
+                                    0.0, -0.0, -1.0, TEST_NAN, TEST_POSINF, TEST_NEGINF };
+
+    for (int i = 0; i < 200000; ++i) {
+        log_inp.push_back(std::ldexp(0.5 + 0.5*unif_dist(engine), -1074 + static_cast<int>(unif_dist(engine) * 2098)));
+    }
+
+    check_kernel("batch_log", stats::internal::batch_log, [](const long double x) { return std::log(x); }, log_inp, 1.0);
+
+    //
+    // exp: the full range, including subnormal results, overflow, and special values
+
+    std::vector<double> exp_inp = { 0.0, -0.0, 1.0, -1.0, 1e-300, -745.2, -745.0, -740.0, -708.5, 709.7, 709.8,
+                                    746.0, -746.0, 1e10, -1e10, TEST_NAN, TEST_POSINF, TEST_NEGINF };
+
+    for (int i = 0; i < 200000; ++i) {
+        exp_inp.push_back(-746.0 + 1456.0 * unif_dist(engine));
+    }
+
+    for (int i = 0; i < 20000; ++i) {
+        exp_inp.push_back(1e-3 * (2.0 * unif_dist(engine) - 1.0));
+    }
+
+    check_kernel("batch_exp", stats::internal::batch_exp, [](const long double x) { return std::exp(x); }, exp_inp, 1.0);
+
+    //
+    // tan(pi x) on (-1/2, 1/2), including points next to the reflection at |x| = 1/4 and the pole
+
+    std::vector<double> tanpi_inp = { 0.0, -0.0, 0.25, -0.25, std::nextafter(0.25,0.0), std::nextafter(0.25,1.0),
+                                      std::nextafter(0.5,0.0), -std::nextafter(0.5,0.0), 1e-300, 0.49999 };
+
+    for (int i = 0; i < 200000; ++i) {
+        tanpi_inp.push_back(unif_dist(engine) - 0.5);
+    }
+
+    // reflected as tan(pi x) = 1 / tan(pi (1/2 - |x|)), with 1/2 - |x| exact, so the reference keeps full precision near the pole
+
+    check_kernel("batch_tanpi", stats::internal::batch_tanpi,
+                 [pi_l](const long double x) {
+                     const long double x_abs = std::abs(x);
+                     const long double tan_abs = x_abs > 0.25L ? 1.0L / std::tan(pi_l * (0.5L - x_abs)) : std::tan(pi_l * x_abs);
+                     return std::copysign(tan_abs, x);
+                 },
+                 tanpi_inp, 3.0);
+
+    //
+
+    print_final("batch_math");
+
+    return 0;
+}
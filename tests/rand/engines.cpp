@@ -0,0 +1,125 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include <sstream>
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("engines");
+
+    //
+    // xoshiro256++
+
+    stats::xoshiro256pp engine_x(1776);
+    stats::xoshiro256pp engine_x_copy = engine_x;
+
+    std::cout << "xoshiro256++ draw: " << engine_x() << std::endl;
+
+    // discard should match repeated draws
+
+    engine_x_copy.discard(1);
+    std::cout << "xoshiro256++ discard matches draws: " << std::boolalpha << (engine_x == engine_x_copy) << std::endl;
+
+    // jumped streams should differ from the base stream
+
+    stats::xoshiro256pp engine_x_jump = engine_x;
+    engine_x_jump.jump();
+    std::cout << "xoshiro256++ jump gives a new stream: " << (engine_x() != engine_x_jump()) << std::endl;
+
+    // save and restore the state
+
+    std::stringstream state_x;
+    state_x << engine_x;
+    const stats::xoshiro256pp::result_type next_x = engine_x();
+
+    stats::xoshiro256pp engine_x_restored;
+    state_x >> engine_x_restored;
+    std::cout << "xoshiro256++ state restored: " << (engine_x_restored() == next_x) << std::endl;
+
+    std::cout << "xoshiro256++ normal rv draw: " << stats::rnorm(2.5,1.5,engine_x) << std::endl;
+
+    //
+    // Philox4x64-10
+
+    // known-answer test (zero key and counter)
+
+    stats::philox4x64 engine_p(0);
+    const stats::philox4x64::result_type philox_kat[4] = { 0x16554d9eca36314cULL, 0xdb20fe9d672d0fdcULL,
+                                                           0xd7e772cee186176bULL, 0x7e68b68aec7ba23bULL };
+
+    bool kat_pass = true;
+    for (int i = 0; i < 4; ++i) {
+        kat_pass = kat_pass && (engine_p() == philox_kat[i]);
+    }
+
+    std::cout << "\nphilox4x64 known-answer test: " << kat_pass << std::endl;
+
+    // constant-time discard should match repeated draws
+
+    stats::philox4x64 engine_p_1(1776), engine_p_2(1776);
+
+    for (int i = 0; i < 1001; ++i) {
+        engine_p_1();
+    }
+
+    engine_p_2.discard(1001);
+    std::cout << "philox4x64 discard matches draws: " << (engine_p_1() == engine_p_2()) << std::endl;
+
+    // save and restore mid-block
+
+    std::stringstream state_p;
+    state_p << engine_p_1;
+    const stats::philox4x64::result_type next_p = engine_p_1();
+
+    stats::philox4x64 engine_p_restored;
+    state_p >> engine_p_restored;
+    std::cout << "philox4x64 state restored: " << (engine_p_restored() == next_p) << std::endl;
+
+    // substreams
+
+    stats::philox4x64 engine_p_s0(1776,0), engine_p_s1(1776,1);
+    std::cout << "philox4x64 substreams differ: " << (engine_p_s0() != engine_p_s1()) << std::endl;
+
+    std::cout << "philox4x64 normal rv draw: " << stats::rnorm(2.5,1.5,engine_p_s0) << std::endl;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::vector<double> normal_stdvec = stats::rnorm<std::vector<double>>(10000,1,2.5,1.5,engine_p_s1);
+
+    std::cout << "stdvec: philox4x64 normal rv mean: " << stats::mat_ops::mean(normal_stdvec) << ". Should be close to: " << 2.5 << std::endl;
+#endif
+
+    //
+    // thread-local default engine
+
+    stats::set_seed(1776);
+    const double default_draw_1 = stats::rnorm(2.5,1.5);
+
+    stats::set_seed(1776);
+    const double default_draw_2 = stats::rnorm(2.5,1.5);
+
+    std::cout << "\ndefault engine: seeded draws reproducible: " << (default_draw_1 == default_draw_2) << std::endl;
+
+    //
+
+    print_final("engines");
+
+    return 0;
+}
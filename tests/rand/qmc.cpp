@@ -0,0 +1,147 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include <algorithm>
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("qmc");
+
+    std::vector<double> point_vals(4);
+
+    //
+    // Sobol
+
+    stats::sobol_seq sobol_gen(4);
+
+    sobol_gen.next(point_vals.data());
+    std::cout << "sobol first point: " << point_vals[0] << ", " << point_vals[1] << ", " << point_vals[2] << ", " << point_vals[3] << ". Should be close to: 0.5, 0.5, 0.5, 0.5" << std::endl;
+
+    sobol_gen.next(point_vals.data());
+    std::cout << "sobol second point: " << point_vals[0] << ", " << point_vals[1] << ", " << point_vals[2] << ", " << point_vals[3] << ". Should be close to: 0.75, 0.25, 0.25, 0.25" << std::endl;
+
+    // discard should match repeated draws
+
+    stats::sobol_seq sobol_gen_skip(4);
+    sobol_gen_skip.discard(1000);
+    sobol_gen_skip.next(point_vals.data());
+    const double sobol_skip_val = point_vals[3];
+
+    sobol_gen.reset();
+    for (int i = 0; i < 1001; ++i) {
+        sobol_gen.next(point_vals.data());
+    }
+
+    std::cout << "sobol discard matches draws: " << std::boolalpha << (point_vals[3] == sobol_skip_val) << std::endl;
+
+    // the first 2^m points of a scrambled sequence hit each interval [i/2^m, (i+1)/2^m) once
+
+    stats::rand_engine_t engine(1776);
+    stats::sobol_seq sobol_gen_scr(4,engine);
+
+    std::vector<int> sobol_counts(1024,0);
+    for (int i = 0; i < 1024; ++i) {
+        sobol_gen_scr.next(point_vals.data());
+        sobol_counts[static_cast<int>(point_vals[2] * 1024)] += 1;
+    }
+
+    std::cout << "scrambled sobol stratified: " << (std::count(sobol_counts.begin(),sobol_counts.end(),1) == 1024) << std::endl;
+
+    //
+    // Halton
+
+    stats::halton_seq halton_gen(4);
+
+    halton_gen.next(point_vals.data());
+    std::cout << "\nhalton first point: " << point_vals[0] << ", " << point_vals[1] << ", " << point_vals[2] << ", " << point_vals[3] << ". Should be close to: 0.5, 0.333, 0.2, 0.143" << std::endl;
+
+    stats::halton_seq halton_gen_scr(4,engine);
+
+    std::vector<int> halton_counts(729,0);
+    for (int i = 0; i < 729; ++i) {
+        halton_gen_scr.next(point_vals.data());
+        halton_counts[static_cast<int>(point_vals[1] * 729)] += 1;
+    }
+
+    std::cout << "scrambled halton stratified: " << (std::count(halton_counts.begin(),halton_counts.end(),1) == 729) << std::endl;
+
+    //
+    // sampling designs
+
+    stats::antithetic_design anti_design(4,engine);
+
+    std::vector<double> point_vals_2(4);
+    anti_design.next(point_vals.data());
+    anti_design.next(point_vals_2.data());
+
+    std::cout << "\nantithetic pair sums to one: " << (point_vals[0] + point_vals_2[0] == 1.0) << std::endl;
+
+    stats::lhs_design lhs(100,4,engine);
+
+    std::vector<int> lhs_counts(100,0);
+    for (int i = 0; i < 100; ++i) {
+        lhs.next(point_vals.data());
+        lhs_counts[static_cast<int>(point_vals[3] * 100)] += 1;
+    }
+
+    std::cout << "latin hypercube margins stratified: " << (std::count(lhs_counts.begin(),lhs_counts.end(),1) == 100) << std::endl;
+
+    stats::stratified_design strat_design(3,4,engine);
+    std::cout << "stratified design cells: " << strat_design.n_cells() << ". Should be: " << 81 << std::endl;
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    //
+    // quantile-based samplers
+
+    stats::sobol_seq sobol_gen_norm(2,engine);
+    std::vector<double> norm_stdvec = stats::rqnorm<std::vector<double>>(4096,1.0,2.0,sobol_gen_norm);
+
+    std::cout << "\nstdvec: sobol normal rv mean: " << stats::mat_ops::mean(norm_stdvec) << ". Should be close to: " << 1.0 << std::endl;
+    std::cout << "stdvec: sobol normal rv variance: " << stats::mat_ops::var(norm_stdvec) << ". Should be close to: " << 4.0 << std::endl;
+
+    stats::halton_seq halton_gen_gamma(3,engine);
+    std::vector<double> gamma_stdvec = stats::rqgamma<std::vector<double>>(2000,2.0,3.0,halton_gen_gamma);
+
+    std::cout << "stdvec: halton gamma rv mean: " << stats::mat_ops::mean(gamma_stdvec) << ". Should be close to: " << 6.0 << std::endl;
+
+    std::vector<double> pois_stdvec = stats::rqmc<std::vector<double>>(2000,2,[](double p){ return stats::qpois(p,3.0); });
+
+    std::cout << "stdvec: sobol poisson rv mean: " << stats::mat_ops::mean(pois_stdvec) << ". Should be close to: " << 3.0 << std::endl;
+
+    stats::lhs_design lhs_logis(1000,2,engine);
+    std::vector<double> logis_stdvec = stats::rqlogis<std::vector<double>>(1000,1.0,2.0,lhs_logis);
+
+    std::cout << "stdvec: latin hypercube logistic rv mean: " << stats::mat_ops::mean(logis_stdvec) << ". Should be close to: " << 1.0 << std::endl;
+#endif
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    stats::sobol_seq sobol_gen_mat(3,engine);
+    mat_obj exp_mat = stats::rqexp<mat_obj>(1024,2.0,sobol_gen_mat);
+
+    std::cout << "\nMatrix: sobol exponential rv mean: " << stats::mat_ops::mean(exp_mat) << ". Should be close to: " << 0.5 << std::endl;
+#endif
+
+    //
+
+    print_final("qmc");
+
+    return 0;
+}
@@ -42,6 +42,15 @@ int main()
 
 #ifdef STATS_TEST_STDVEC_FEATURES
     std::cout << "\n";
+
+    // packed draws, 64 per word: exact for dyadic p and otherwise
+
+    for (double prob_test : {0.5, 0.125, 0.3}) {
+        std::vector<double> bern_packed = stats::rbern<std::vector<double>>(n_sample,1,prob_test,1776);
+
+        std::cout << "stdvec: bern rv mean (p = " << prob_test << "): " << stats::mat_ops::mean(bern_packed) << ". Should be close to: " << prob_test << "\n";
+    }
+
     std::vector<double> bern_stdvec = stats::rbern<std::vector<double>>(n_sample,1,prob_par);
 
     std::cout << "stdvec: bern rv mean: " << stats::mat_ops::mean(bern_stdvec) << ". Should be close to: " << bern_mean << "\n";
@@ -20,6 +20,25 @@
 
 #include "../stats_tests.hpp"
 
+// draws against the distribution function at x_vals, and the support [0,1]
+
+inline
+void
+check_beta_draws(const std::string fn_name, const std::vector<double>& draws, const double a_par, const double b_par,
+                 const std::vector<double>& x_vals)
+{
+    for (const double x : x_vals) {
+        check_draw_freq(fn_name,draws,x,stats::pbeta(x,a_par,b_par));
+    }
+
+    bool in_support = true;
+    for (const double x : draws) {
+        in_support = in_support && (x >= 0.0 && x <= 1.0);
+    }
+
+    std::cout << fn_name << " (" << a_par << ", " << b_par << "): draws within [0,1]: " << (in_support ? "true" : "false") << std::endl;
+}
+
 int main()
 {
     print_begin("rbeta");
@@ -39,6 +58,53 @@ int main()
     double beta_rand = stats::rbeta(alpha,beta);
     std::cout << "beta rv draw: " << beta_rand << std::endl;
 
+    // limiting cases: a zero or infinite shape puts all mass at 0, 1 or 1/2
+
+    std::mt19937_64 engine_lim(1776);
+
+    check_close("rbeta(0,b)",2.0,stats::rbeta(0.0,2.0,engine_lim),0.0);
+    check_close("rbeta(a,0)",2.0,stats::rbeta(2.0,0.0,engine_lim),1.0);
+    check_close("rbeta(inf,b)",2.0,stats::rbeta(TEST_POSINF,2.0,engine_lim),1.0);
+    check_close("rbeta(a,inf)",2.0,stats::rbeta(2.0,TEST_POSINF,engine_lim),0.0);
+    check_close("rbeta(0,inf)",0.0,stats::rbeta(0.0,TEST_POSINF,engine_lim),0.0);
+    check_close("rbeta(inf,inf)",TEST_POSINF,stats::rbeta(TEST_POSINF,TEST_POSINF,engine_lim),0.5);
+
+    // both shapes zero: a fair coin over {0, 1}
+
+    const int n_check = 100000;
+
+    std::vector<double> beta_coin(n_check);
+    bool coin_vals = true;
+    for (double& x : beta_coin) {
+        x = stats::rbeta(0.0,0.0,engine_lim);
+        coin_vals = coin_vals && (x == 0.0 || x == 1.0);
+    }
+
+    check_draw_freq("rbeta(0,0)",beta_coin,0.0,0.5);
+
+    std::cout << "beta(0,0) draws in {0, 1}: " << (coin_vals ? "true" : "false") << std::endl;
+
+    // both shapes at most 1 (Johnk's method), where with very small shapes both powers often underflow
+    // and are rescaled in log-space; and one shape above 1, which takes the two-gamma path
+
+    std::mt19937_64 engine_j(1776);
+
+    const std::vector<std::vector<double>> shape_vals = { { 0.5, 0.7 }, { 1.0, 1.0 }, { 0.001, 0.003 }, { 3.0, 0.5 } };
+
+    for (const std::vector<double>& shape_j : shape_vals) {
+        std::vector<double> beta_draws(n_check);
+        for (double& x : beta_draws) {
+            x = stats::rbeta(shape_j[0],shape_j[1],engine_j);
+        }
+
+        // nearly all of the mass of Beta(0.001, 0.003) lies within 1e-10 of 0 or 1
+
+        const std::vector<double> x_vals = (shape_j[0] < 0.01) ? std::vector<double>{ 1e-100, 1e-10, 0.5, 1.0 - 1e-10 } :
+                                                                  std::vector<double>{ 0.1, 0.5, 0.9 };
+
+        check_beta_draws("rbeta (scalar)",beta_draws,shape_j[0],shape_j[1],x_vals);
+    }
+
     //
 
 #ifdef STATS_TEST_STDVEC_FEATURES
@@ -47,6 +113,22 @@ int main()
 
     std::cout << "stdvec: beta rv mean: " << stats::mat_ops::mean(beta_stdvec) << ". Should be close to: " << beta_mean << "\n";
     std::cout << "stdvec: beta rv variance: " << stats::mat_ops::var(beta_stdvec) << ". Should be close to: " << beta_var << std::endl;
+
+    // the bulk fill should match a sequence of scalar draws from the same engine, on both sampling paths and a limit case
+
+    bool fill_matches_scalar = true;
+
+    for (const std::vector<double>& shape_j : { std::vector<double>{ 0.5, 0.7 }, std::vector<double>{ 0.001, 0.003 },
+                                                std::vector<double>{ 3.0, 0.5 }, std::vector<double>{ 0.0, 0.0 } }) {
+        std::mt19937_64 engine_e1(1776), engine_e2(1776);
+        std::vector<double> beta_stdvec_e1 = stats::rbeta<std::vector<double>>(n_sample,1,shape_j[0],shape_j[1],engine_e1);
+
+        for (int i = 0; i < n_sample; ++i) {
+            fill_matches_scalar = fill_matches_scalar && (beta_stdvec_e1[i] == stats::rbeta(shape_j[0],shape_j[1],engine_e2));
+        }
+    }
+
+    std::cout << "stdvec: bulk fill matches scalar draws: " << (fill_matches_scalar ? "true" : "false") << std::endl;
 #endif
 
 #ifdef STATS_TEST_MATRIX_FEATURES
@@ -39,6 +39,16 @@ int main()
     int binom_rand = stats::rbinom(n_trials,prob_par);
     std::cout << "binom rv draw: " << binom_rand << std::endl;
 
+    // large number of trials (BTPE)
+
+    stats::rand_engine_t engine(1776);
+    double binom_large_mean = 0.0;
+    for (int i = 0; i < n_sample; ++i) {
+        binom_large_mean += stats::rbinom(1000000,0.3,engine) / double(n_sample);
+    }
+
+    std::cout << "binom rv mean (n = 10^6): " << binom_large_mean << ". Should be close to: " << 300000 << std::endl;
+
     //
 
 #ifdef STATS_TEST_STDVEC_FEATURES
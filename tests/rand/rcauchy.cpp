@@ -44,6 +44,21 @@ int main()
 
     std::cout << "stdvec: cauchy rv mean: " << stats::mat_ops::mean(cauchy_stdvec) << ". Note: not defined." << std::endl; // not defined
     std::cout << "stdvec: cauchy rv variance: " << stats::mat_ops::var(cauchy_stdvec) << ". Note: not defined." << std::endl; // not defined
+
+    // bulk fill against scalar draws from the same engine: batch_tanpi replaces tan(pi (u - 1/2)), and
+    // draws near the pole are large, hence the |a-e|/(1+|e|) measure
+
+    std::mt19937_64 engine_e1(1776), engine_e2(1776);
+    std::vector<double> cauchy_stdvec_e1 = stats::rcauchy<std::vector<double>>(n_sample + 3,1,mu,sigma,engine_e1);
+
+    double fill_max_diff = 0.0;
+    for (int i = 0; i < n_sample + 3; ++i) {
+        const double scalar_draw = stats::rcauchy(mu,sigma,engine_e2);
+        fill_max_diff = std::max(fill_max_diff, std::abs(cauchy_stdvec_e1[i] - scalar_draw) / (1.0 + std::abs(scalar_draw)));
+        check_close("rcauchy (bulk fill vs scalar)",i,cauchy_stdvec_e1[i],scalar_draw,false,1e-12);
+    }
+
+    std::cout << "stdvec: bulk fill vs scalar draws, largest difference: " << fill_max_diff << ". Should be at most: 1e-12" << std::endl;
 #endif
 
     //
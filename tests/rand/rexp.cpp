@@ -46,6 +46,21 @@ int main()
 
     std::cout << "exp rv mean: " << stats::mat_ops::mean(exp_stdvec) << ". Should be close to: " << exp_mean << std::endl;
     std::cout << "exp rv variance: " << stats::mat_ops::var(exp_stdvec) << ". Should be close to: " << exp_var << std::endl;
+
+    // the bulk fill (-log(u) / rate, through batch_log) should agree with scalar draws from the same engine;
+    // n_sample + 3 is not a multiple of the kernel width, so the tail is covered too
+
+    std::mt19937_64 engine_e1(1776), engine_e2(1776);
+    std::vector<double> exp_stdvec_e1 = stats::rexp<std::vector<double>>(n_sample + 3,1,rate_par,engine_e1);
+
+    double fill_max_diff = 0.0;
+    for (int i = 0; i < n_sample + 3; ++i) {
+        const double scalar_draw = stats::rexp(rate_par,engine_e2);
+        fill_max_diff = std::max(fill_max_diff, std::abs(exp_stdvec_e1[i] - scalar_draw) / (1.0 + std::abs(scalar_draw)));
+        check_close("rexp (bulk fill vs scalar)",i,exp_stdvec_e1[i],scalar_draw,false,1e-12);
+    }
+
+    std::cout << "stdvec: bulk fill vs scalar draws, largest difference: " << fill_max_diff << ". Should be at most: 1e-12" << std::endl;
 #endif
 
     //
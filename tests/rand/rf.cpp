@@ -20,6 +20,25 @@
 
 #include "../stats_tests.hpp"
 
+// draws against the distribution function at x_vals
+
+inline
+void
+check_f_draws(const std::string fn_name, const std::vector<double>& draws, const double df1_par, const double df2_par,
+              const std::vector<double>& x_vals)
+{
+    for (const double x : x_vals) {
+        check_draw_freq(fn_name,draws,x,stats::pf(x,df1_par,df2_par));
+    }
+
+    bool non_negative = true;
+    for (const double x : draws) {
+        non_negative = non_negative && (x >= 0.0);
+    }
+
+    std::cout << fn_name << " (" << df1_par << ", " << df2_par << "): draws non-negative: " << (non_negative ? "true" : "false") << std::endl;
+}
+
 int main()
 {
     print_begin("rf");
@@ -39,6 +58,30 @@ int main()
     double F_rand = stats::rf(a_par,b_par);
     std::cout << "F rv draw: " << F_rand << std::endl;
 
+    // F = (df2/df1) X/(1-X) for X ~ Beta(df1/2, df2/2): both degrees of freedom at most 2 takes Johnk's
+    // method (at 0.002 and 0.006, mostly through the log-space rescale), and df2 > 2 the two-gamma path
+
+    const int n_check = 100000;
+
+    std::mt19937_64 engine_j(1776);
+
+    const std::vector<std::vector<double>> df_vals = { { 1.0, 1.5 }, { 0.002, 0.006 }, { 1.0, 10.0 } };
+
+    for (const std::vector<double>& df_j : df_vals) {
+        std::vector<double> F_draws(n_check);
+        for (double& x : F_draws) {
+            x = stats::rf(df_j[0],df_j[1],engine_j);
+        }
+
+        // with tiny degrees of freedom, the mass sits at the extremes
+
+        const std::vector<double> x_vals = (df_j[0] < 0.01) ? std::vector<double>{ 1e-100, 1e-10, 1.0, 1e10 } :
+                                                               std::vector<double>{ stats::qf(0.1,df_j[0],df_j[1]), stats::qf(0.5,df_j[0],df_j[1]),
+                                                                                    stats::qf(0.9,df_j[0],df_j[1]) };
+
+        check_f_draws("rf (scalar)",F_draws,df_j[0],df_j[1],x_vals);
+    }
+
     //
 
 #ifdef STATS_TEST_STDVEC_FEATURES
@@ -47,6 +90,21 @@ int main()
 
     std::cout << "stdvec: F rv mean: " << stats::mat_ops::mean(F_stdvec) << ". Should be close to: " << F_mean << std::endl;
     std::cout << "stdvec: F rv variance: " << stats::mat_ops::var(F_stdvec) << ". Should be close to: " << F_var << std::endl;
+
+    // the vector draws should match a sequence of scalar draws from the same engine
+
+    bool vec_matches_scalar = true;
+
+    for (const std::vector<double>& df_j : df_vals) {
+        std::mt19937_64 engine_e1(1776), engine_e2(1776);
+        std::vector<double> F_stdvec_e1 = stats::rf<std::vector<double>>(n_sample,1,df_j[0],df_j[1],engine_e1);
+
+        for (int i = 0; i < n_sample; ++i) {
+            vec_matches_scalar = vec_matches_scalar && (F_stdvec_e1[i] == stats::rf(df_j[0],df_j[1],engine_e2));
+        }
+    }
+
+    std::cout << "stdvec: vector draws match scalar draws: " << (vec_matches_scalar ? "true" : "false") << std::endl;
 #endif
 
     //
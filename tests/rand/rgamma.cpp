@@ -20,6 +20,24 @@
 
 #include "../stats_tests.hpp"
 
+// draws against the 10%, 50% and 90% quantiles, and the support
+
+inline
+void
+check_gamma_draws(const std::string fn_name, const std::vector<double>& draws, const double shape, const double scale)
+{
+    for (const double prob : { 0.1, 0.5, 0.9 }) {
+        check_draw_freq(fn_name,draws,stats::qgamma(prob,shape,scale),prob);
+    }
+
+    bool positive_finite = true;
+    for (const double x : draws) {
+        positive_finite = positive_finite && (x >= 0.0 && std::isfinite(x));
+    }
+
+    std::cout << fn_name << " (shape = " << shape << "): draws non-negative and finite: " << (positive_finite ? "true" : "false") << std::endl;
+}
+
 int main()
 {
     print_begin("rgamma");
@@ -39,6 +57,24 @@ int main()
     double gamma_rand = stats::rgamma(shape,scale);
     std::cout << "gamma rv draw: " << gamma_rand << std::endl;
 
+    std::cout << "gamma rv draw, seeded twice: " << (stats::rgamma(shape,scale,1776) == stats::rgamma(shape,scale,1776) ? "true" : "false") << std::endl;
+
+    // shape below, at and above 1; shape < 1 draws X ~ Gamma(shape + 1) and boosts it to X U^(1/shape)
+
+    const std::vector<double> shape_vals = { 0.05, 0.4, 1.0, 3.0 };
+    const int n_check = 100003; // not a multiple of STATS_RGAMMA_BATCH_SIZE
+
+    for (const double shape_j : shape_vals) {
+        std::mt19937_64 engine_j(1776);
+
+        std::vector<double> gamma_draws(n_check);
+        for (double& x : gamma_draws) {
+            x = stats::rgamma(shape_j,scale,engine_j);
+        }
+
+        check_gamma_draws("rgamma (scalar)",gamma_draws,shape_j,scale);
+    }
+
     //
 
 #ifdef STATS_TEST_STDVEC_FEATURES
@@ -47,6 +83,51 @@ int main()
 
     std::cout << "stdvec: gamma rv mean: " << stats::mat_ops::mean(gamma_stdvec) << ". Should be close to: " << gamma_mean << std::endl;
     std::cout << "stdvec: gamma rv variance: " << stats::mat_ops::var(gamma_stdvec) << ". Should be close to: " << gamma_var << std::endl;
+
+    // the batch sampler (rgamma_fill) for the same shapes; n_check leaves a partial block of candidates,
+    // and the short fill below stops part way through the third block
+
+    for (const double shape_j : shape_vals) {
+        std::mt19937_64 engine_j(1776);
+        std::vector<double> gamma_stdvec_j = stats::rgamma<std::vector<double>>(n_check,1,shape_j,scale,engine_j);
+
+        check_gamma_draws("rgamma (stdvec fill)",gamma_stdvec_j,shape_j,scale);
+    }
+
+    const int n_short = 2*STATS_RGAMMA_BATCH_SIZE + 37;
+
+    std::mt19937_64 engine_short(1776);
+    std::vector<double> gamma_stdvec_short = stats::rgamma<std::vector<double>>(n_short,1,0.4,scale,engine_short);
+
+    bool short_filled = (static_cast<int>(gamma_stdvec_short.size()) == n_short);
+    for (const double x : gamma_stdvec_short) {
+        short_filled = short_filled && (x >= 0.0 && std::isfinite(x));
+    }
+
+    std::cout << "stdvec: fill of " << n_short << " draws complete: " << (short_filled ? "true" : "false") << std::endl;
+
+    // seeded draws should not depend on the number of threads, and engine draws should repeat with the engine
+
+#ifdef STATS_USE_OPENMP
+    int n_threads_max = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+
+    std::vector<double> gamma_stdvec_s1 = stats::rgamma<std::vector<double>>(n_check,1,0.4,scale,1776);
+
+#ifdef STATS_USE_OPENMP
+    omp_set_num_threads(n_threads_max);
+#endif
+
+    std::vector<double> gamma_stdvec_s2 = stats::rgamma<std::vector<double>>(n_check,1,0.4,scale,1776);
+
+    std::cout << "stdvec: seeded draws reproducible: " << (gamma_stdvec_s1 == gamma_stdvec_s2 ? "true" : "false") << std::endl;
+
+    std::mt19937_64 engine_e1(1776), engine_e2(1776);
+    std::vector<double> gamma_stdvec_e1 = stats::rgamma<std::vector<double>>(n_short,1,0.4,scale,engine_e1);
+    std::vector<double> gamma_stdvec_e2 = stats::rgamma<std::vector<double>>(n_short,1,0.4,scale,engine_e2);
+
+    std::cout << "stdvec: engine draws reproducible: " << (gamma_stdvec_e1 == gamma_stdvec_e2 ? "true" : "false") << std::endl;
 #endif
 
     //
@@ -47,6 +47,21 @@ int main()
 
     std::cout << "stdvec: laplace rv mean: " << stats::mat_ops::mean(laplace_stdvec) << ". Should be close to: " << laplace_mean << std::endl;
     std::cout << "stdvec: laplace rv variance: " << stats::mat_ops::var(laplace_stdvec) << ". Should be close to: " << laplace_var << std::endl;
+
+    // bulk fill (batch_log on the folded uniform) against scalar draws from the same engine; the length
+    // n_sample + 3 leaves a partial chunk
+
+    std::mt19937_64 engine_e1(1776), engine_e2(1776);
+    std::vector<double> laplace_stdvec_e1 = stats::rlaplace<std::vector<double>>(n_sample + 3,1,mu,sigma,engine_e1);
+
+    double fill_max_diff = 0.0;
+    for (int i = 0; i < n_sample + 3; ++i) {
+        const double scalar_draw = stats::rlaplace(mu,sigma,engine_e2);
+        fill_max_diff = std::max(fill_max_diff, std::abs(laplace_stdvec_e1[i] - scalar_draw) / (1.0 + std::abs(scalar_draw)));
+        check_close("rlaplace (bulk fill vs scalar)",i,laplace_stdvec_e1[i],scalar_draw,false,1e-12);
+    }
+
+    std::cout << "stdvec: bulk fill vs scalar draws, largest difference: " << fill_max_diff << ". Should be at most: 1e-12" << std::endl;
 #endif
 
     //
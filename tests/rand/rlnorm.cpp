@@ -47,6 +47,20 @@ int main()
 
     std::cout << "stdvec: lnorm rv mean: " << stats::mat_ops::mean(lnorm_stdvec) << ". Should be close to: " << lnorm_mean << std::endl;
     std::cout << "stdvec: lnorm rv variance: " << stats::mat_ops::var(lnorm_stdvec) << ". Should be close to: " << lnorm_var << std::endl;
+
+    // bulk fill (exp of normal draws, through batch_exp) against scalar draws from the same engine
+
+    std::mt19937_64 engine_e1(1776), engine_e2(1776);
+    std::vector<double> lnorm_stdvec_e1 = stats::rlnorm<std::vector<double>>(n_sample + 3,1,mu,sigma,engine_e1);
+
+    double fill_max_diff = 0.0;
+    for (int i = 0; i < n_sample + 3; ++i) {
+        const double scalar_draw = stats::rlnorm(mu,sigma,engine_e2);
+        fill_max_diff = std::max(fill_max_diff, std::abs(lnorm_stdvec_e1[i] - scalar_draw) / (1.0 + std::abs(scalar_draw)));
+        check_close("rlnorm (bulk fill vs scalar)",i,lnorm_stdvec_e1[i],scalar_draw,false,1e-12);
+    }
+
+    std::cout << "stdvec: bulk fill vs scalar draws, largest difference: " << fill_max_diff << ". Should be at most: 1e-12" << std::endl;
 #endif
 
     //
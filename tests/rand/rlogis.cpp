@@ -47,6 +47,21 @@ int main()
 
     std::cout << "stdvec: logis rv mean: " << stats::mat_ops::mean(logis_stdvec) << ". Should be close to: " << logis_mean << std::endl;
     std::cout << "stdvec: logis rv variance: " << stats::mat_ops::var(logis_stdvec) << ". Should be close to: " << logis_var << std::endl;
+
+    // bulk fill (log(u/(1-u)) via batch_log) against scalar draws from the same engine, over a length
+    // that leaves a tail past the last full kernel chunk
+
+    std::mt19937_64 engine_e1(1776), engine_e2(1776);
+    std::vector<double> logis_stdvec_e1 = stats::rlogis<std::vector<double>>(n_sample + 3,1,mu,sigma,engine_e1);
+
+    double fill_max_diff = 0.0;
+    for (int i = 0; i < n_sample + 3; ++i) {
+        const double scalar_draw = stats::rlogis(mu,sigma,engine_e2);
+        fill_max_diff = std::max(fill_max_diff, std::abs(logis_stdvec_e1[i] - scalar_draw) / (1.0 + std::abs(scalar_draw)));
+        check_close("rlogis (bulk fill vs scalar)",i,logis_stdvec_e1[i],scalar_draw,false,1e-12);
+    }
+
+    std::cout << "stdvec: bulk fill vs scalar draws, largest difference: " << fill_max_diff << ". Should be at most: 1e-12" << std::endl;
 #endif
 
     //
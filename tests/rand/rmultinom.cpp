@@ -49,6 +49,25 @@ int main()
 
     std::cout << "sample mean:\n" << X / 5.0 << std::endl;
 
+    // explicit number of trials and batch draws (one draw per row)
+
+    stats::rand_engine_t engine(1776);
+
+    std::cout << "rmultinom draw with 20 trials:\n" << stats::rmultinom(20,prob_vec,engine) << std::endl;
+
+    mat_obj X_batch = stats::rmultinom(n,1000,prob_vec,engine);
+
+    mat_obj X_mean;
+    stats::mat_ops::zeros(X_mean,1,5);
+
+    for (int i=0; i < n; i++) {
+        for (int j=0; j < 5; j++) {
+            X_mean(0,j) += X_batch(i,j) / (n * 1000.0);
+        }
+    }
+
+    std::cout << "batch sample mean (1000 trials, scaled):\n" << X_mean << std::endl;
+
     //
 
     std::cout << "\n*** rmultinom: end tests. ***\n" << std::endl;
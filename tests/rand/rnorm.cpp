@@ -39,6 +39,9 @@ int main()
     double normal_rand = stats::rnorm(mu,sigma);
     std::cout << "normal rv draw: " << normal_rand << std::endl;
 
+    std::mt19937 engine_32(1776);
+    std::cout << "normal rv draw (std::mt19937 engine): " << stats::rnorm(mu,sigma,engine_32) << std::endl;
+
     //
 
 #ifdef STATS_TEST_STDVEC_FEATURES
@@ -47,6 +50,39 @@ int main()
 
     std::cout << "stdvec: normal rv mean: " << stats::mat_ops::mean(normal_stdvec) << ". Should be close to: " << normal_mean << std::endl;
     std::cout << "stdvec: normal rv variance: " << stats::mat_ops::var(normal_stdvec) << ". Should be close to: " << normal_var << std::endl;
+
+    // seeded draws should not depend on the number of threads
+
+#ifdef STATS_USE_OPENMP
+    int n_threads_max = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+
+    std::vector<double> normal_stdvec_s1 = stats::rnorm<std::vector<double>>(n_sample,1,mu,sigma,1776);
+
+#ifdef STATS_USE_OPENMP
+    omp_set_num_threads(n_threads_max);
+#endif
+
+    std::vector<double> normal_stdvec_s2 = stats::rnorm<std::vector<double>>(n_sample,1,mu,sigma,1776);
+
+    std::cout << "stdvec: seeded draws reproducible: " << (normal_stdvec_s1 == normal_stdvec_s2 ? "true" : "false") << std::endl;
+
+    std::minstd_rand engine_e1(1776), engine_e2(1776);
+    std::vector<double> normal_stdvec_e1 = stats::rnorm<std::vector<double>>(n_sample,1,mu,sigma,engine_e1);
+    std::vector<double> normal_stdvec_e2 = stats::rnorm<std::vector<double>>(n_sample,1,mu,sigma,engine_e2);
+
+    std::cout << "stdvec: engine draws reproducible: " << (normal_stdvec_e1 == normal_stdvec_e2 ? "true" : "false") << std::endl;
+
+    // the bulk fill should match a sequence of scalar draws from the same engine
+
+    std::minstd_rand engine_e3(1776);
+    bool fill_matches_scalar = true;
+    for (int i = 0; i < n_sample; ++i) {
+        fill_matches_scalar = fill_matches_scalar && (normal_stdvec_e1[i] == stats::rnorm(mu,sigma,engine_e3));
+    }
+
+    std::cout << "stdvec: bulk fill matches scalar draws: " << (fill_matches_scalar ? "true" : "false") << std::endl;
 #endif
 
     //
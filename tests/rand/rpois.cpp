@@ -38,6 +38,16 @@ int main()
     double pois_rand = stats::rpois(rate_par);
     std::cout << "pois rv draw: " << pois_rand << std::endl;
 
+    // large rate (PTRS)
+
+    stats::rand_engine_t engine(1776);
+    double pois_large_mean = 0.0;
+    for (int i = 0; i < n_sample; ++i) {
+        pois_large_mean += stats::rpois(250.0,engine) / double(n_sample);
+    }
+
+    std::cout << "pois rv mean (rate = 250): " << pois_large_mean << ". Should be close to: " << 250 << std::endl;
+
     //
 
 #ifdef STATS_TEST_STDVEC_FEATURES
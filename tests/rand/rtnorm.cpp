@@ -0,0 +1,134 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("rtnorm");
+
+    //
+
+    double mu = 1.0;
+    double sigma = 2.0;
+
+    int n_sample = 10000;
+
+    // moments of the truncated Normal: with alpha = (a-mu)/sigma and beta = (b-mu)/sigma,
+    // E[X] = mu + sigma (phi(alpha) - phi(beta)) / Z, with Z = Phi(beta) - Phi(alpha)
+
+    auto tnorm_mean = [&](const double a, const double b)
+    {
+        const double alpha = (a - mu) / sigma;
+        const double beta = (b - mu) / sigma;
+
+        const double Z = stats::pnorm(beta,0.0,1.0) - stats::pnorm(alpha,0.0,1.0);
+
+        return mu + sigma * (stats::dnorm(alpha,0.0,1.0) - stats::dnorm(beta,0.0,1.0)) / Z;
+    };
+
+    //
+
+    double tnorm_rand = stats::rtnorm(mu,sigma,0.0,TEST_POSINF);
+    std::cout << "truncated normal rv draw: " << tnorm_rand << std::endl;
+
+    std::mt19937 engine_32(1776);
+    std::cout << "truncated normal rv draw (std::mt19937 engine): " << stats::rtnorm(mu,sigma,0.0,TEST_POSINF,engine_32) << std::endl;
+
+    std::cout << "far tail draw on [50,inf): " << stats::rtnorm(0.0,1.0,50.0,TEST_POSINF,engine_32) << ". Should be slightly above 50" << std::endl;
+    std::cout << "invalid bounds: " << stats::rtnorm(mu,sigma,2.0,1.0,engine_32) << ". Should be nan" << std::endl;
+
+    // each proposal type: normal, half-normal, uniform, exponential, and a reflected interval
+
+    const double bounds[6][2] = { {-3.0, 4.0}, {1.0, TEST_POSINF}, {1.5, 2.5}, {7.0, TEST_POSINF}, {8.0, 9.0}, {TEST_NEGINF, -6.0} };
+
+    std::cout << "\n";
+
+    for (int i = 0; i < 6; ++i)
+    {
+        double draw_sum = 0.0;
+        bool in_bounds = true;
+
+        for (int j = 0; j < n_sample; ++j)
+        {
+            const double draw_val = stats::rtnorm(mu,sigma,bounds[i][0],bounds[i][1],engine_32);
+
+            draw_sum += draw_val;
+            in_bounds = in_bounds && (draw_val >= bounds[i][0] && draw_val <= bounds[i][1]);
+        }
+
+        std::cout << "[" << bounds[i][0] << ", " << bounds[i][1] << "]: mean: " << draw_sum / n_sample
+                  << ". Should be close to: " << tnorm_mean(bounds[i][0],bounds[i][1])
+                  << ". In bounds: " << (in_bounds ? "true" : "false") << std::endl;
+    }
+
+    //
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::cout << "\n";
+    std::vector<double> tnorm_stdvec = stats::rtnorm<std::vector<double>>(n_sample,1,mu,sigma,0.0,TEST_POSINF);
+
+    std::cout << "stdvec: truncated normal rv mean: " << stats::mat_ops::mean(tnorm_stdvec) << ". Should be close to: " << tnorm_mean(0.0,TEST_POSINF) << std::endl;
+
+    // seeded draws should not depend on the number of threads
+
+#ifdef STATS_USE_OPENMP
+    int n_threads_max = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+
+    std::vector<double> tnorm_stdvec_s1 = stats::rtnorm<std::vector<double>>(n_sample,1,mu,sigma,-1.0,0.5,1776);
+
+#ifdef STATS_USE_OPENMP
+    omp_set_num_threads(n_threads_max);
+#endif
+
+    std::vector<double> tnorm_stdvec_s2 = stats::rtnorm<std::vector<double>>(n_sample,1,mu,sigma,-1.0,0.5,1776);
+
+    std::cout << "stdvec: seeded draws reproducible: " << (tnorm_stdvec_s1 == tnorm_stdvec_s2 ? "true" : "false") << std::endl;
+
+    // the bulk fill should match a sequence of scalar draws from the same engine
+
+    std::minstd_rand engine_e1(1776), engine_e2(1776);
+    std::vector<double> tnorm_stdvec_e1 = stats::rtnorm<std::vector<double>>(n_sample,1,mu,sigma,7.0,TEST_POSINF,engine_e1);
+
+    bool fill_matches_scalar = true;
+    for (int i = 0; i < n_sample; ++i) {
+        fill_matches_scalar = fill_matches_scalar && (tnorm_stdvec_e1[i] == stats::rtnorm(mu,sigma,7.0,TEST_POSINF,engine_e2));
+    }
+
+    std::cout << "stdvec: bulk fill matches scalar draws: " << (fill_matches_scalar ? "true" : "false") << std::endl;
+#endif
+
+    //
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    std::cout << "\n";
+    mat_obj tnorm_vec = stats::rtnorm<mat_obj>(n_sample,1,mu,sigma,0.0,TEST_POSINF);
+
+    std::cout << "Matrix: truncated normal rv mean: " << stats::mat_ops::mean(tnorm_vec) << ". Should be close to: " << tnorm_mean(0.0,TEST_POSINF) << std::endl;
+#endif
+
+    //
+
+    std::cout << "\n*** rtnorm: end tests. ***\n" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("rtrunc");
+
+    //
+
+    double shape = 2.0;
+    double scale = 1.5;
+
+    double lower = 1.0;
+    double upper = 4.0;
+
+    int n_sample = 10000;
+
+    auto cdf_fn = [&](const double x) { return stats::pgamma(x,shape,scale); };
+    auto quant_fn = [&](const double p) { return stats::qgamma(p,shape,scale); };
+
+    // E[X | a <= X <= b] for a Gamma(k,theta) is k theta (P(k+1; b) - P(k+1; a)) / (P(k; b) - P(k; a))
+
+    double trunc_mean = shape * scale * (stats::pgamma(upper,shape+1,scale) - stats::pgamma(lower,shape+1,scale)) \
+                            / (cdf_fn(upper) - cdf_fn(lower));
+
+    //
+
+    double trunc_rand = stats::rtrunc(cdf_fn,quant_fn,lower,upper);
+    std::cout << "truncated gamma rv draw: " << trunc_rand << std::endl;
+
+    std::mt19937 engine_32(1776);
+    std::cout << "truncated gamma rv draw (std::mt19937 engine): " << stats::rtrunc(cdf_fn,quant_fn,lower,upper,engine_32) << std::endl;
+
+    std::cout << "invalid bounds: " << stats::rtrunc(cdf_fn,quant_fn,upper,lower,engine_32) << ". Should be nan" << std::endl;
+
+    // discrete support: a Poisson(3) truncated to [2,5] keeps the point mass at the lower bound
+
+    double pois_rate = 3.0;
+
+    auto pois_cdf_fn = [&](const double x) { return stats::ppois(static_cast<stats::llint_t>(std::floor(x)),pois_rate); };
+    auto pois_quant_fn = [&](const double p) { return stats::qpois(p,pois_rate); };
+
+    double pois_lower = 2.0;
+    double pois_upper = 5.0;
+
+    double pois_lower_prob = stats::dpois(2,pois_rate) / (stats::ppois(5,pois_rate) - stats::ppois(1,pois_rate));
+
+    std::mt19937 engine_pois(1776);
+
+    int n_lower = 0;
+    bool pois_in_support = true;
+
+    for (int i = 0; i < n_sample; ++i) {
+        const double pois_draw = stats::rtrunc(pois_cdf_fn,pois_quant_fn,pois_lower,pois_upper,engine_pois);
+
+        n_lower += (pois_draw == pois_lower);
+        pois_in_support = pois_in_support && (pois_draw >= pois_lower && pois_draw <= pois_upper && pois_draw == std::floor(pois_draw));
+    }
+
+    std::cout << "truncated Poisson: draws in {2,...,5}: " << (pois_in_support ? "true" : "false") << std::endl;
+    std::cout << "truncated Poisson: fraction of draws at the lower bound: " << double(n_lower) / n_sample 
+              << ". Should be close to: " << pois_lower_prob << std::endl;
+
+    //
+
+#ifdef STATS_TEST_STDVEC_FEATURES
+    std::cout << "\n";
+    std::vector<double> trunc_stdvec = stats::rtrunc<std::vector<double>>(n_sample,1,cdf_fn,quant_fn,lower,upper);
+
+    std::cout << "stdvec: truncated gamma rv mean: " << stats::mat_ops::mean(trunc_stdvec) << ". Should be close to: " << trunc_mean << std::endl;
+
+    bool in_bounds = true;
+    for (int i = 0; i < n_sample; ++i) {
+        in_bounds = in_bounds && (trunc_stdvec[i] >= lower && trunc_stdvec[i] <= upper);
+    }
+
+    std::cout << "stdvec: draws within bounds: " << (in_bounds ? "true" : "false") << std::endl;
+
+    // the bulk fill should match a sequence of scalar draws from the same engine
+
+    std::minstd_rand engine_e1(1776), engine_e2(1776);
+    std::vector<double> trunc_stdvec_e1 = stats::rtrunc<std::vector<double>>(n_sample,1,cdf_fn,quant_fn,lower,upper,engine_e1);
+
+    bool fill_matches_scalar = true;
+    for (int i = 0; i < n_sample; ++i) {
+        fill_matches_scalar = fill_matches_scalar && (trunc_stdvec_e1[i] == stats::rtrunc(cdf_fn,quant_fn,lower,upper,engine_e2));
+    }
+
+    std::cout << "stdvec: bulk fill matches scalar draws: " << (fill_matches_scalar ? "true" : "false") << std::endl;
+#endif
+
+    //
+
+#ifdef STATS_TEST_MATRIX_FEATURES
+    std::cout << "\n";
+    mat_obj trunc_vec = stats::rtrunc<mat_obj>(n_sample,1,cdf_fn,quant_fn,lower,upper);
+
+    std::cout << "Matrix: truncated gamma rv mean: " << stats::mat_ops::mean(trunc_vec) << ". Should be close to: " << trunc_mean << std::endl;
+#endif
+
+    //
+
+    std::cout << "\n*** rtrunc: end tests. ***\n" << std::endl;
+
+    return 0;
+}
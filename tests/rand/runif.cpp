@@ -47,6 +47,12 @@ int main()
 
     std::cout << "unif rv mean: " << stats::mat_ops::mean(unif_stdvec) << ". Should be close to: " << unif_mean << std::endl;
     std::cout << "unif rv variance: " << stats::mat_ops::var(unif_stdvec) << ". Should be close to: " << unif_var << std::endl;
+
+    // single precision: two 24-bit draws per engine call
+
+    std::vector<float> unif_stdvec_f = stats::runif<std::vector<float>>(n_sample,1,float(a_par),float(b_par));
+
+    std::cout << "unif rv mean (float): " << stats::mat_ops::mean(unif_stdvec_f) << ". Should be close to: " << unif_mean << std::endl;
 #endif
 
     //
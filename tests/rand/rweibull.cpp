@@ -47,6 +47,33 @@ int main()
 
     std::cout << "weibull rv mean: " << stats::mat_ops::mean(weibull_stdvec) << ". Should be close to: " << weibull_mean << std::endl;
     std::cout << "weibull rv variance: " << stats::mat_ops::var(weibull_stdvec) << ". Should be close to: " << weibull_var << std::endl;
+
+    // the bulk fill takes (-log(u))^(1/shape) through batch_log and batch_exp; it should agree with scalar
+    // draws from the same engine, for shape > 1 and shape < 1 (where the power amplifies any log error)
+
+    std::mt19937_64 engine_e1(1776), engine_e2(1776);
+    std::vector<double> weibull_stdvec_e1 = stats::rweibull<std::vector<double>>(n_sample + 3,1,shape,scale,engine_e1);
+
+    double fill_max_diff = 0.0;
+    for (int i = 0; i < n_sample + 3; ++i) {
+        const double scalar_draw = stats::rweibull(shape,scale,engine_e2);
+        fill_max_diff = std::max(fill_max_diff, std::abs(weibull_stdvec_e1[i] - scalar_draw) / (1.0 + std::abs(scalar_draw)));
+        check_close("rweibull (bulk fill vs scalar)",i,weibull_stdvec_e1[i],scalar_draw,false,1e-12);
+    }
+
+    std::cout << "stdvec: bulk fill vs scalar draws, largest difference: " << fill_max_diff << ". Should be at most: 1e-12" << std::endl;
+
+    std::mt19937_64 engine_e1_2(1776), engine_e2_2(1776);
+    std::vector<double> weibull_stdvec_e1_2 = stats::rweibull<std::vector<double>>(n_sample + 3,1,0.7,scale,engine_e1_2);
+
+    double fill_max_diff_2 = 0.0;
+    for (int i = 0; i < n_sample + 3; ++i) {
+        const double scalar_draw = stats::rweibull(0.7,scale,engine_e2_2);
+        fill_max_diff_2 = std::max(fill_max_diff_2, std::abs(weibull_stdvec_e1_2[i] - scalar_draw) / (1.0 + std::abs(scalar_draw)));
+        check_close("rweibull (bulk fill vs scalar)",i,weibull_stdvec_e1_2[i],scalar_draw,false,1e-12);
+    }
+
+    std::cout << "stdvec: shape < 1, bulk fill vs scalar draws, largest difference: " << fill_max_diff_2 << ". Should be at most: 1e-12" << std::endl;
 #endif
 
     //
@@ -0,0 +1,93 @@
+/*################################################################################
+  ##
+  ##   Copyright (C) 2011-2020 Keith O'Hara
+  ##
+  ##   This file is part of the StatsLib C++ library.
+  ##
+  ##   Licensed under the Apache License, Version 2.0 (the "License");
+  ##   you may not use this file except in compliance with the License.
+  ##   You may obtain a copy of the License at
+  ##
+  ##       http://www.apache.org/licenses/LICENSE-2.0
+  ##
+  ##   Unless required by applicable law or agreed to in writing, software
+  ##   distributed under the License is distributed on an "AS IS" BASIS,
+  ##   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  ##   See the License for the specific language governing permissions and
+  ##   limitations under the License.
+  ##
+  ################################################################################*/
+
+#include "../stats_tests.hpp"
+
+int main()
+{
+    print_begin("sampler");
+
+    //
+
+    double shape = 2.5;
+    double scale = 1.5;
+
+    double gamma_mean = shape * scale;
+
+    int n_sample = 10000;
+
+    //
+
+    stats::gamma_dist gamma_obj(shape,scale);
+
+    std::mt19937 engine_32(1776);
+    std::cout << "gamma dist draw (std::mt19937 engine): " << gamma_obj(engine_32) << std::endl;
+
+    //
+
+    stats::sampler<stats::gamma_dist> gamma_draws(gamma_obj,1776);
+
+    double draw_sum = 0.0;
+    for (int i = 0; i < n_sample; ++i) {
+        draw_sum += gamma_draws.next();
+    }
+
+    std::cout << "sampler: gamma rv mean: " << draw_sum / n_sample << ". Should be close to: " << gamma_mean << std::endl;
+    std::cout << "sampler: index: " << gamma_draws.index() << ". Should be: " << n_sample << std::endl;
+
+    // the stream should not depend on how it is consumed
+
+    std::vector<double> vals_next(n_sample), vals_mixed(n_sample);
+
+    gamma_draws.reset();
+    for (int i = 0; i < n_sample; ++i) {
+        vals_next[i] = gamma_draws();
+    }
+
+    gamma_draws.reset();
+    vals_mixed[0] = gamma_draws.next();
+    gamma_draws.fill(vals_mixed.data() + 1,2500);
+    gamma_draws.fill(vals_mixed.data() + 2501,3);
+
+    stats::sampler<stats::gamma_dist>::iterator draw_iter = gamma_draws.begin();
+    for (int i = 2504; i < n_sample; ++i, ++draw_iter) {
+        vals_mixed[i] = *draw_iter;
+    }
+
+    std::cout << "sampler: next() and fill() streams match: " << (vals_next == vals_mixed ? "true" : "false") << std::endl;
+
+    stats::sampler<stats::gamma_dist> gamma_draws_2(gamma_obj,1776);
+
+    std::cout << "sampler: seeded streams reproducible: " << (gamma_draws_2.next() == vals_next[0] ? "true" : "false") << std::endl;
+
+    // samplers seeded from the same engine should differ
+
+    stats::rand_engine_t engine(1776);
+    stats::sampler<stats::norm_dist> norm_draws_1({1.0,2.0},engine);
+    stats::sampler<stats::norm_dist> norm_draws_2({1.0,2.0},engine);
+
+    std::cout << "sampler: streams seeded from one engine differ: " << (norm_draws_1.next() != norm_draws_2.next() ? "true" : "false") << std::endl;
+
+    //
+
+    std::cout << "\n*** sampler: end tests. ***\n" << std::endl;
+
+    return 0;
+}
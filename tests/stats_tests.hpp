@@ -324,6 +324,74 @@ log_if(const T x, const bool log_form)
     STATS_TEST_EXPECTED_VAL(fn_eval, val_inp, expected_val, false, __VA_ARGS__)                     \
 }
 
+//
+// compare two evaluations of the same quantity (e.g., a batched call against the scalar function);
+// rel_err switches the error measure from |a-e|/(1+|e|) to |a-e|/|e|, for values near zero, and
+// err_tol tightens the tolerance for accuracy checks against high-precision reference values
+
+inline
+void
+check_close(const std::string fn_name, const double arg, const double actual, const double expected,
+            const bool rel_err = false, const double err_tol = TEST_ERR_TOL)
+{
+    ++STATS_TEST_NUMBER;
+
+    const double err_val = std::abs(actual - expected) / ((rel_err ? 0 : 1) + std::abs(expected));
+
+    if ((VAL_IS_NAN(expected) && VAL_IS_NAN(actual)) || (VAL_IS_INF(expected) && actual == expected) || err_val < err_tol) {
+        return;
+    }
+
+    std::cerr << "\033[31m Test failed!\033[0m\n";
+    std::cerr << "  - Test number: " << STATS_TEST_NUMBER << "\n";
+    std::cerr << "  - Function Call:  " << fn_name << "(" << arg << ");\n";
+    std::cerr << "  - Expected value: " << expected << "\n";
+    std::cerr << "  - Actual value:   " << actual << "\n";
+    std::cerr << "  - Error value:    " << err_val << "\n";
+
+    throw std::runtime_error("test fail");
+}
+
+//
+// the fraction of random draws at or below quant_val, against the nominal probability prob;
+// the tolerance is six binomial standard errors
+
+template<typename vecT>
+inline
+double
+check_draw_freq(const std::string fn_name, const vecT& draws, const double quant_val, const double prob)
+{
+    double n_below = 0.0;
+
+    for (const double x : draws) {
+        n_below += (x <= quant_val) ? 1.0 : 0.0;
+    }
+
+    const double n_draws = static_cast<double>(draws.size());
+    const double freq_below = n_below / n_draws;
+
+    check_close(fn_name,quant_val,freq_below,prob,false,6.0*std::sqrt(prob*(1.0 - prob) / n_draws) / (1.0 + prob));
+
+    return freq_below;
+}
+
+//
+// vector input of fn_eval against the scalar function, element by element (both log_form cases for d/p)
+
+#define STATS_TEST_VEC_VS_SCALAR(fn_eval, vals_inp, ...)                                            \
+{                                                                                                   \
+    for (int log_ind = 0; log_ind < 2 - STATS_TEST_INPUT_TYPE; ++log_ind) {                         \
+        const bool log_form = (log_ind == 1);                                                       \
+        STATS_UNUSED_PAR(log_form);                                                                 \
+        std::vector<double> vec_vals =                                                              \
+            TEST_STRIP_FN_ARGS(stats::fn_eval,vals_inp,log_form,__VA_ARGS__);                       \
+        for (size_t j = 0; j < vals_inp.size(); ++j) {                                              \
+            check_close(#fn_eval,vals_inp[j],vec_vals[j],                                           \
+                        TEST_STRIP_FN_ARGS(stats::fn_eval,vals_inp[j],log_form,__VA_ARGS__));       \
+        }                                                                                           \
+    }                                                                                               \
+}
+
 //
 // matrix tests
 //